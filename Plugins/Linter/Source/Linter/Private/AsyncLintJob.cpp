@@ -0,0 +1,339 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#include "AsyncLintJob.h"
+#include "Async/Async.h"
+#include "Misc/QueuedThreadPool.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+
+#include "AssetRegistryModule.h"
+#include "IAssetRegistry.h"
+
+#include "Linter.h"
+#include "LintRuleSet.h"
+#include "LintRunner.h"
+#include "LinterSettings.h"
+
+TMap<FObjectKey, double> FAsyncLintJob::GameThreadRuleSecondsPerByte;
+
+FAsyncLintJob::FAsyncLintJob(const ULintRuleSet* InRuleSet, const TArray<FAssetData>& InAssetList)
+	: FAsyncLintJob(TArray<const ULintRuleSet*>({ InRuleSet }), InAssetList)
+{
+}
+
+FAsyncLintJob::FAsyncLintJob(const TArray<const ULintRuleSet*>& InRuleSets, const TArray<FAssetData>& InAssetList)
+	: RuleSets(InRuleSets)
+	, AssetList(InAssetList)
+	, SharedState(MakeShared<FSharedState, ESPMode::ThreadSafe>())
+{
+}
+
+FAsyncLintJob::~FAsyncLintJob()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+
+	// Workers reference objects we keep alive, so make sure they're done before we stop referencing them
+	SharedState->CancellationToken.Cancel();
+
+	// Queued game thread work returns straight away once cancelled, but it still has to run to let go of its asset
+	RunGameThreadWork(TNumericLimits<double>::Max());
+
+	while (SharedState->NumInFlight.GetValue() > 0)
+	{
+		FPlatformProcess::Sleep(0.001f);
+	}
+}
+
+void FAsyncLintJob::Start()
+{
+	check(IsInGameThread());
+	check(RuleSets.Num() > 0);
+
+	for (const ULintRuleSet* RuleSet : RuleSets)
+	{
+		check(RuleSet != nullptr);
+		RuleSet->LoadNamingConvention();
+	}
+
+	// Assets that no rules apply to are clean without loading them, so they complete straight away
+	TArray<FAssetData> SkippedAssets;
+	NumAssetsSkipped = ULintRuleSet::RemoveAssetsWithoutLintRules(RuleSets, AssetList, &SkippedAssets);
+	for (const FAssetData& Asset : SkippedAssets)
+	{
+		FLintAssetResult Result;
+		Result.AssetData = Asset;
+		Result.bCompleted = true;
+		SharedState->Results.Enqueue(MoveTemp(Result));
+	}
+
+	if (NumAssetsSkipped > 0)
+	{
+		UE_LOG(LogLinter, Display, TEXT("Skipped loading %d assets that no lint rules apply to."), NumAssetsSkipped);
+	}
+
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FAsyncLintJob::Tick));
+}
+
+void FAsyncLintJob::Cancel()
+{
+	SharedState->CancellationToken.Cancel();
+}
+
+bool FAsyncLintJob::Tick(float DeltaTime)
+{
+	// Don't load more assets than the workers can keep up with
+	const int32 MaxInFlight = GThreadPool != nullptr ? GThreadPool->GetNumThreads() * 2 : 2;
+
+	int32 NumStarted = 0;
+	while (NextAssetIndex < AssetList.Num() && NumStarted < MaxAssetsStartedPerTick && SharedState->NumInFlight.GetValue() < MaxInFlight && !IsCancelled())
+	{
+		const FAssetData& Asset = AssetList[NextAssetIndex++];
+		UObject* Object = Asset.GetAsset();
+		if (Object == nullptr)
+		{
+			UE_LOG(LogLinter, Warning, TEXT("Failed to load \"%s\" for linting."), *Asset.ObjectPath.ToString());
+			NumAssetsCompleted++;
+			continue;
+		}
+
+		LintObject(Asset, Object);
+		NumStarted++;
+	}
+
+	// Once cancelled, queued game thread work returns straight away, so drain all of it
+	const double GameThreadBudgetSeconds = FMath::Max(GetDefault<ULinterSettings>()->GameThreadLintBudgetMs, 1.0f) / 1000.0;
+	RunGameThreadWork(IsCancelled() ? TNumericLimits<double>::Max() : GameThreadBudgetSeconds);
+
+	const bool bDoneDispatching = NextAssetIndex >= AssetList.Num() || IsCancelled();
+	if (bDoneDispatching && GameThreadWork.Num() == 0)
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void FAsyncLintJob::RunGameThreadWork(double BudgetSeconds)
+{
+	if (GameThreadWork.Num() == 0)
+	{
+		return;
+	}
+
+	// Estimates improve as rules run, so refresh them before ordering
+	for (FGameThreadWorkItem& Item : GameThreadWork)
+	{
+		Item.EstimatedSeconds = EstimateGameThreadSeconds(Item.Rule, Item.PackageBytes);
+	}
+	GameThreadWork.StableSort([](const FGameThreadWorkItem& A, const FGameThreadWorkItem& B) { return A.EstimatedSeconds > B.EstimatedSeconds; });
+
+	// Run the most expensive items that still fit. The budget only shrinks, so items skipped once never fit later in the frame
+	double RemainingSeconds = BudgetSeconds;
+	bool bRanAny = false;
+	int32 ItemIndex = 0;
+	while (ItemIndex < GameThreadWork.Num() && RemainingSeconds > 0.0)
+	{
+		if (GameThreadWork[ItemIndex].EstimatedSeconds > RemainingSeconds)
+		{
+			ItemIndex++;
+			continue;
+		}
+
+		const FGameThreadWorkItem Item = MoveTemp(GameThreadWork[ItemIndex]);
+		GameThreadWork.RemoveAt(ItemIndex, 1, /*bAllowShrinking =*/false);
+		RemainingSeconds -= RunGameThreadWorkItem(Item);
+		bRanAny = true;
+	}
+
+	// When nothing fits at all, run the cheapest item alone so the job still makes progress, at the cost of a single long frame
+	if (!bRanAny)
+	{
+		const FGameThreadWorkItem Item = GameThreadWork.Pop(/*bAllowShrinking =*/false);
+		RunGameThreadWorkItem(Item);
+	}
+}
+
+double FAsyncLintJob::RunGameThreadWorkItem(const FGameThreadWorkItem& Item)
+{
+	FPendingAsset& Pending = *Item.Pending;
+	if (IsCancelled())
+	{
+		FinishPart(*SharedState, Pending, /*bPartCompleted =*/false);
+		return 0.0;
+	}
+
+	FLintCancellationToken::FScope CancellationScope(&SharedState->CancellationToken);
+
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<FLintRuleViolation> RuleViolations;
+	Item.Rule->PassesRule(Pending.Result.LintedObject, Item.RuleSet, RuleViolations);
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	Item.RuleSet->TagRuleViolations(RuleViolations);
+
+	// Smooth the measurement in, so one unusual asset doesn't throw off the order of everything after it
+	const double SecondsPerByte = ElapsedSeconds / (double)FMath::Max<int64>(Item.PackageBytes, 1);
+	double* PreviousSecondsPerByte = GameThreadRuleSecondsPerByte.Find(FObjectKey(Item.Rule->GetClass()));
+	if (PreviousSecondsPerByte != nullptr)
+	{
+		*PreviousSecondsPerByte += (SecondsPerByte - *PreviousSecondsPerByte) * 0.25;
+	}
+	else
+	{
+		GameThreadRuleSecondsPerByte.Add(FObjectKey(Item.Rule->GetClass()), SecondsPerByte);
+	}
+
+	Pending.GameThreadRuleViolations.Append(MoveTemp(RuleViolations));
+	FinishPart(*SharedState, Pending, !IsCancelled());
+	return ElapsedSeconds;
+}
+
+double FAsyncLintJob::EstimateGameThreadSeconds(const ULintRule* Rule, int64 PackageBytes)
+{
+	const double* SecondsPerByte = GameThreadRuleSecondsPerByte.Find(FObjectKey(Rule->GetClass()));
+	return SecondsPerByte != nullptr ? *SecondsPerByte * (double)PackageBytes : DefaultGameThreadRuleSeconds;
+}
+
+void FAsyncLintJob::FinishPart(FSharedState& State, FPendingAsset& Pending, bool bPartCompleted)
+{
+	if (!bPartCompleted)
+	{
+		Pending.bCancelled = true;
+	}
+
+	if (Pending.NumPartsRemaining.Decrement() == 0)
+	{
+		Pending.Result.RuleViolations.Append(MoveTemp(Pending.GameThreadRuleViolations));
+		Pending.Result.bCompleted = !Pending.bCancelled && !State.CancellationToken.IsCancelled();
+		State.Results.Enqueue(MoveTemp(Pending.Result));
+		State.NumInFlight.Decrement();
+	}
+}
+
+void FAsyncLintJob::LintObject(const FAssetData& Asset, UObject* Object)
+{
+	InFlightObjects.Add(Object);
+	SharedState->NumInFlight.Increment();
+
+	// Runners resolve their rule list on construction, which may load classes, so always create them on the game thread.
+	// Rules that can run anywhere run together on the thread pool, every rule set's one after another, while each rule that has to run
+	// on the game thread, such as a rule implemented in Blueprint, is queued on its own so it can be scheduled within the game thread budget.
+	TSharedRef<FPendingAsset, ESPMode::ThreadSafe> Pending = MakeShared<FPendingAsset, ESPMode::ThreadSafe>();
+	Pending->Result.AssetData = Asset;
+	Pending->Result.LintedObject = Object;
+
+	TSharedRef<FLintRunner, ESPMode::ThreadSafe> AnyThreadRunner = MakeShareable(new FLintRunner(Object, RuleSets, &Pending->Result.RuleViolations, nullptr, &SharedState->CancellationToken, ELintRuleThreadFilter::AnyThreadRules));
+	const bool bHasAnyThreadRules = AnyThreadRunner->HasRulesToRun();
+
+	TArray<TPair<const ULintRuleSet*, const ULintRule*>> GameThreadRules;
+	for (const ULintRuleSet* RuleSet : RuleSets)
+	{
+		if (const FLintRuleList* RuleList = RuleSet->GetLintRuleListForClass(Object->GetClass()))
+		{
+			for (const ULintRule* Rule : RuleList->GetRules(ELintRuleThreadFilter::GameThreadRules))
+			{
+				GameThreadRules.Emplace(RuleSet, Rule);
+			}
+		}
+	}
+
+	const int32 NumParts = (bHasAnyThreadRules ? 1 : 0) + GameThreadRules.Num();
+	Pending->NumPartsRemaining.Set(FMath::Max(NumParts, 1));
+
+	if (NumParts == 0)
+	{
+		FinishPart(*SharedState, *Pending, /*bPartCompleted =*/true);
+		return;
+	}
+
+	if (bHasAnyThreadRules)
+	{
+		TSharedRef<FSharedState, ESPMode::ThreadSafe> State = SharedState;
+		Async(EAsyncExecution::ThreadPool, [State, Pending, AnyThreadRunner]()
+		{
+			FinishPart(*State, *Pending, AnyThreadRunner->Run() != 1);
+		});
+	}
+
+	if (GameThreadRules.Num() > 0)
+	{
+		// Rule costs are learned per byte, so bigger packages are expected to take longer
+		int64 PackageBytes = DefaultPackageBytes;
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		if (const FAssetPackageData* PackageData = AssetRegistry.GetAssetPackageData(Asset.PackageName))
+		{
+			PackageBytes = FMath::Max<int64>(PackageData->DiskSize, 1);
+		}
+
+		for (const TPair<const ULintRuleSet*, const ULintRule*>& RuleSetAndRule : GameThreadRules)
+		{
+			FGameThreadWorkItem& Item = GameThreadWork.AddDefaulted_GetRef();
+			Item.Pending = Pending;
+			Item.RuleSet = RuleSetAndRule.Key;
+			Item.Rule = RuleSetAndRule.Value;
+			Item.PackageBytes = PackageBytes;
+		}
+	}
+}
+
+void FAsyncLintJob::DrainResults(TArray<FLintRuleViolation>& OutRuleViolations, TArray<FAssetData>* OutLintedAssets /*= nullptr*/)
+{
+	check(IsInGameThread());
+
+	FLintAssetResult Result;
+	while (SharedState->Results.Dequeue(Result))
+	{
+		if (Result.LintedObject != nullptr)
+		{
+			InFlightObjects.RemoveSingleSwap(Result.LintedObject);
+		}
+		OutRuleViolations.Append(MoveTemp(Result.RuleViolations));
+		if (OutLintedAssets != nullptr && Result.bCompleted)
+		{
+			OutLintedAssets->Add(Result.AssetData);
+		}
+		NumAssetsCompleted++;
+	}
+}
+
+bool FAsyncLintJob::IsFinished() const
+{
+	const bool bDoneDispatching = NextAssetIndex >= AssetList.Num() || IsCancelled();
+	return bDoneDispatching && GameThreadWork.Num() == 0 && SharedState->NumInFlight.GetValue() == 0 && SharedState->Results.IsEmpty();
+}
+
+void FAsyncLintJob::PrioritizeAssetsInPaths(TArray<FAssetData>& AssetList, const TArray<FString>& PriorityPaths)
+{
+	if (PriorityPaths.Num() == 0)
+	{
+		return;
+	}
+
+	auto GetPriority = [&PriorityPaths](const FAssetData& Asset)
+	{
+		const FString PackagePath = Asset.PackagePath.ToString();
+		for (int32 PathIndex = 0; PathIndex < PriorityPaths.Num(); ++PathIndex)
+		{
+			FString PriorityPath = PriorityPaths[PathIndex];
+			PriorityPath.RemoveFromEnd(TEXT("/"));
+			if (PackagePath.Equals(PriorityPath, ESearchCase::IgnoreCase) || PackagePath.StartsWith(PriorityPath + TEXT("/"), ESearchCase::IgnoreCase))
+			{
+				return PathIndex;
+			}
+		}
+		return PriorityPaths.Num();
+	};
+
+	AssetList.StableSort([&GetPriority](const FAssetData& A, const FAssetData& B) { return GetPriority(A) < GetPriority(B); });
+}
+
+void FAsyncLintJob::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (const ULintRuleSet*& RuleSet : RuleSets)
+	{
+		Collector.AddReferencedObject(RuleSet);
+	}
+	Collector.AddReferencedObjects(InFlightObjects);
+}
@@ -1,6 +1,8 @@
 // Copyright 2016 Gamemakin LLC. All Rights Reserved.
 
 #include "BatchRenameTool/BatchRenameTool.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Framework/Text/TextLayout.h"
 #include "Widgets/Layout/SBox.h"
@@ -30,7 +32,7 @@ FDlgBatchRenameTool::FDlgBatchRenameTool(const TArray<FAssetData> Assets)
 			.SupportsMinimize(false).SupportsMaximize(false)
 			.SaneWindowPlacement(true)
 			.AutoCenter(EAutoCenter::PreferredWorkArea)
-			.ClientSize(FVector2D(350, 165));
+			.ClientSize(FVector2D(500, 450));
 
 		TSharedPtr<SBorder> DialogWrapper =
 			SNew(SBorder)
@@ -39,6 +41,7 @@ FDlgBatchRenameTool::FDlgBatchRenameTool(const TArray<FAssetData> Assets)
 			[
 				SAssignNew(DialogWidget, SDlgBatchRenameTool)
 				.ParentWindow(DialogWindow)
+				.Assets(SelectedAssets)
 			];
 
 		DialogWindow->SetContent(DialogWrapper.ToSharedRef());
@@ -52,79 +55,23 @@ FDlgBatchRenameTool::EResult FDlgBatchRenameTool::ShowModal()
 
 	if (UserResponse == EResult::Confirm)
 	{
-		Prefix = DialogWidget->PrefixTextBox->GetText().ToString();
-		Suffix = DialogWidget->SuffixTextBox->GetText().ToString();
-		bRemovePrefix = DialogWidget->PrefixRemoveBox->IsChecked();
-		bRemoveSuffix = DialogWidget->SuffixRemoveBox->IsChecked();
-
-		Find = DialogWidget->FindTextBox->GetText().ToString();
-		Replace = DialogWidget->ReplaceTextBox->GetText().ToString();
+		const FBatchRenameOptions Options = DialogWidget->GetOptions();
+		Prefix = Options.Prefix;
+		Suffix = Options.Suffix;
+		bRemovePrefix = Options.bRemovePrefix;
+		bRemoveSuffix = Options.bRemoveSuffix;
+		Find = Options.Find;
+		Replace = Options.Replace;
 
 		// If no information is given, treat as canceled
-		if (Prefix.IsEmpty() && Suffix.IsEmpty() && Find.IsEmpty())
+		if (Options.IsEmpty())
 		{
 			return EResult::Cancel;
 		}
 
-		FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
-		TArray<FAssetRenameData> AssetsAndNames;
-
-		for (auto AssetIt = SelectedAssets.CreateConstIterator(); AssetIt; ++AssetIt)
-		{
-			const FAssetData& Asset = *AssetIt;
-
-			// Early out on assets that can not be renamed
-			if (!(!Asset.IsRedirector() && Asset.AssetClass != NAME_Class && !(Asset.PackageFlags & PKG_FilterEditorOnly)))
-			{
-				continue;
-			}
-
-			// Work on a copy of the asset name and see if after name operations
-			// if the copy is different than the original before creating rename data
-			FString AssetNewName = Asset.AssetName.ToString();
-
-			if (!Find.IsEmpty())
-			{
-				AssetNewName.ReplaceInline(*Find, *Replace);
-			}
-
-			if (!Prefix.IsEmpty())
-			{
-				if (bRemovePrefix)
-				{
-					AssetNewName.RemoveFromStart(Prefix, ESearchCase::CaseSensitive);
-				}
-				else
-				{
-					if (!AssetNewName.StartsWith(Prefix, ESearchCase::CaseSensitive))
-					{
-						AssetNewName.InsertAt(0, Prefix);
-					}
-				}
-			}
-
-			if (!Suffix.IsEmpty())
-			{
-				if (bRemoveSuffix)
-				{
-					AssetNewName.RemoveFromEnd(Suffix, ESearchCase::CaseSensitive);
-				}
-				else
-				{
-					if (!AssetNewName.EndsWith(Suffix, ESearchCase::CaseSensitive))
-					{
-						AssetNewName = AssetNewName.Append(Suffix);
-					}
-				}
-			}
-
-			if (AssetNewName != Asset.AssetName.ToString())
-			{
-				AssetsAndNames.Push(FAssetRenameData(Asset.GetAsset(), Asset.PackagePath.ToString(), AssetNewName));
-			}
-		}
-
-		if (!AssetToolsModule.Get().RenameAssets(AssetsAndNames))
+		// Plan again rather than trusting the preview, in case assets were added while the dialog was open
+		const TArray<FBatchRenameEntry> Entries = FBatchRenamer::Plan(SelectedAssets, Options, FBatchRenamer::GatherExistingPackageNames(SelectedAssets));
+		if (!FBatchRenamer::Execute(Entries))
 		{
 			FNotificationInfo NotificationInfo(LOCTEXT("BatchRenameFailed", "Batch Rename operation did not fully complete successfully. Maybe fix up redirectors? Check Output Log for details!"));
 			NotificationInfo.ExpireDuration = 6.0f;
@@ -140,6 +87,8 @@ void SDlgBatchRenameTool::Construct(const FArguments& InArgs)
 {
 	UserResponse = FDlgBatchRenameTool::Cancel;
 	ParentWindow = InArgs._ParentWindow.Get();
+	Assets = InArgs._Assets;
+	ExistingPackageNames = FBatchRenamer::GatherExistingPackageNames(Assets);
 
 	this->ChildSlot[
 		SNew(SVerticalBox)
@@ -167,12 +116,14 @@ void SDlgBatchRenameTool::Construct(const FArguments& InArgs)
 				.Padding(0.0f, 0.0f, 8.0f, 0.0f)
 				[
 					SAssignNew(PrefixTextBox, SEditableTextBox)
+					.OnTextChanged_Lambda([this](const FText&) { RefreshPreview(); })
 				]
 			+ SHorizontalBox::Slot()
 				.AutoWidth()
 				.Padding(0.0f, 0.0f, 0.0f, 0.0f)
 				[
 					SAssignNew(PrefixRemoveBox, SCheckBox)
+					.OnCheckStateChanged_Lambda([this](ECheckBoxState) { RefreshPreview(); })
 				]
 			+ SHorizontalBox::Slot()
 				.AutoWidth()
@@ -207,12 +158,14 @@ void SDlgBatchRenameTool::Construct(const FArguments& InArgs)
 				.Padding(0.0f, 0.0f, 8.0f, 0.0f)
 				[
 					SAssignNew(SuffixTextBox, SEditableTextBox)
+					.OnTextChanged_Lambda([this](const FText&) { RefreshPreview(); })
 				]
 				+ SHorizontalBox::Slot()
 				.AutoWidth()
 				.Padding(0.0f, 0.0f, 0.0f, 0.0f)
 				[
 					SAssignNew(SuffixRemoveBox, SCheckBox)
+					.OnCheckStateChanged_Lambda([this](ECheckBoxState) { RefreshPreview(); })
 				]
 				+ SHorizontalBox::Slot()
 				.AutoWidth()
@@ -251,6 +204,7 @@ void SDlgBatchRenameTool::Construct(const FArguments& InArgs)
 			.Padding(0.0f, 0.0f, 8.0f, 0.0f)
 			[
 				SAssignNew(FindTextBox, SEditableTextBox)
+				.OnTextChanged_Lambda([this](const FText&) { RefreshPreview(); })
 			]
 		]
 		+ SVerticalBox::Slot()
@@ -275,6 +229,7 @@ void SDlgBatchRenameTool::Construct(const FArguments& InArgs)
 			.Padding(0.0f, 0.0f, 8.0f, 0.0f)
 			[
 				SAssignNew(ReplaceTextBox, SEditableTextBox)
+				.OnTextChanged_Lambda([this](const FText&) { RefreshPreview(); })
 			]
 		]
 		+ SVerticalBox::Slot()
@@ -283,6 +238,27 @@ void SDlgBatchRenameTool::Construct(const FArguments& InArgs)
 		[
 			SNew(SSeparator)
 		]
+		// Preview
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(8.0f, 4.0f, 8.0f, 4.0f)
+		[
+			SNew(STextBlock)
+			.Text(this, &SDlgBatchRenameTool::GetPreviewSummary)
+		]
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		.Padding(8.0f, 4.0f, 8.0f, 4.0f)
+		[
+			SNew(SBorder)
+			.BorderImage(FEditorStyle::GetBrush("ToolPanel.DarkGroupBorder"))
+			[
+				SAssignNew(PreviewListView, SListView<TSharedPtr<FBatchRenameEntry>>)
+				.ListItemsSource(&PreviewEntries)
+				.OnGenerateRow(this, &SDlgBatchRenameTool::OnGeneratePreviewRow)
+				.SelectionMode(ESelectionMode::None)
+			]
+		]
 		+ SVerticalBox::Slot()
 		.AutoHeight()
 		.HAlign(HAlign_Right)
@@ -317,4 +293,59 @@ FDlgBatchRenameTool::EResult SDlgBatchRenameTool::GetUserResponse() const
 	return UserResponse;
 }
 
+FBatchRenameOptions SDlgBatchRenameTool::GetOptions() const
+{
+	FBatchRenameOptions Options;
+	Options.Prefix = PrefixTextBox->GetText().ToString();
+	Options.Suffix = SuffixTextBox->GetText().ToString();
+	Options.bRemovePrefix = PrefixRemoveBox->IsChecked();
+	Options.bRemoveSuffix = SuffixRemoveBox->IsChecked();
+	Options.Find = FindTextBox->GetText().ToString();
+	Options.Replace = ReplaceTextBox->GetText().ToString();
+	return Options;
+}
+
+void SDlgBatchRenameTool::RefreshPreview()
+{
+	PreviewEntries.Reset();
+	NumPreviewConflicts = 0;
+
+	// Text boxes fire while the dialog is still being constructed
+	if (!PrefixTextBox.IsValid() || !SuffixTextBox.IsValid() || !FindTextBox.IsValid() || !ReplaceTextBox.IsValid() || !PrefixRemoveBox.IsValid() || !SuffixRemoveBox.IsValid())
+	{
+		return;
+	}
+
+	const FBatchRenameOptions Options = GetOptions();
+	if (!Options.IsEmpty())
+	{
+		for (FBatchRenameEntry& Entry : FBatchRenamer::Plan(Assets, Options, ExistingPackageNames))
+		{
+			NumPreviewConflicts += Entry.HasConflict() ? 1 : 0;
+			PreviewEntries.Add(MakeShareable(new FBatchRenameEntry(MoveTemp(Entry))));
+		}
+	}
+
+	if (PreviewListView.IsValid())
+	{
+		PreviewListView->RequestListRefresh();
+	}
+}
+
+FText SDlgBatchRenameTool::GetPreviewSummary() const
+{
+	return FText::Format(LOCTEXT("BatchRenamePreviewSummary", "{0} of {1} assets will be renamed. {2} skipped because of name conflicts."), PreviewEntries.Num() - NumPreviewConflicts, Assets.Num(), NumPreviewConflicts);
+}
+
+TSharedRef<ITableRow> SDlgBatchRenameTool::OnGeneratePreviewRow(TSharedPtr<FBatchRenameEntry> Entry, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<TSharedPtr<FBatchRenameEntry>>, OwnerTable)
+		.ToolTipText(Entry->Conflict)
+		[
+			SNew(STextBlock)
+			.Text(FText::Format(LOCTEXT("BatchRenamePreviewRow", "{0} -> {1}"), FText::FromName(Entry->AssetData.AssetName), FText::FromString(Entry->NewName)))
+			.ColorAndOpacity(Entry->HasConflict() ? FSlateColor(FLinearColor::Red) : FSlateColor::UseForeground())
+		];
+}
+
 #undef LOCTEXT_NAMESPACE
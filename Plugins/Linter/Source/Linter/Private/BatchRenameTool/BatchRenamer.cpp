@@ -0,0 +1,294 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+
+#include "BatchRenameTool/BatchRenamer.h"
+#include "Async/ParallelFor.h"
+#include "AssetRegistryModule.h"
+#include "IAssetRegistry.h"
+#include "AssetToolsModule.h"
+#include "IAssetTools.h"
+#include "FileHelpers.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/ObjectRedirector.h"
+
+#include "Linter.h"
+#include "LintRule.h"
+#include "LintRedirectorFixer.h"
+
+#define LOCTEXT_NAMESPACE "LinterBatchRenamer"
+
+FString FBatchRenameOptions::Apply(const FString& AssetName) const
+{
+	FString NewName = AssetName;
+
+	if (!Find.IsEmpty())
+	{
+		NewName.ReplaceInline(*Find, *Replace);
+	}
+
+	if (!Prefix.IsEmpty())
+	{
+		if (bRemovePrefix)
+		{
+			NewName.RemoveFromStart(Prefix, ESearchCase::CaseSensitive);
+		}
+		else if (!NewName.StartsWith(Prefix, ESearchCase::CaseSensitive))
+		{
+			NewName.InsertAt(0, Prefix);
+		}
+	}
+
+	if (!Suffix.IsEmpty())
+	{
+		if (bRemoveSuffix)
+		{
+			NewName.RemoveFromEnd(Suffix, ESearchCase::CaseSensitive);
+		}
+		else if (!NewName.EndsWith(Suffix, ESearchCase::CaseSensitive))
+		{
+			NewName.Append(Suffix);
+		}
+	}
+
+	return NewName;
+}
+
+bool FBatchRenamer::CanRename(const FAssetData& Asset)
+{
+	return !Asset.IsRedirector() && Asset.AssetClass != NAME_Class && !(Asset.PackageFlags & PKG_FilterEditorOnly);
+}
+
+TSet<FName> FBatchRenamer::GatherExistingPackageNames(const TArray<FAssetData>& Assets)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	TSet<FName> PackagePaths;
+	for (const FAssetData& Asset : Assets)
+	{
+		PackagePaths.Add(Asset.PackagePath);
+	}
+
+	// Renames never move assets, so only the folders they're already in can collide
+	TSet<FName> ExistingPackageNames;
+	for (const FName PackagePath : PackagePaths)
+	{
+		TArray<FAssetData> AssetsInPath;
+		AssetRegistry.GetAssetsByPath(PackagePath, AssetsInPath, /*bRecursive =*/false, /*bIncludeOnlyOnDiskAssets =*/false);
+		for (const FAssetData& Asset : AssetsInPath)
+		{
+			ExistingPackageNames.Add(Asset.PackageName);
+		}
+	}
+
+	return ExistingPackageNames;
+}
+
+TArray<FBatchRenameEntry> FBatchRenamer::Plan(const TArray<FAssetData>& Assets, const FBatchRenameOptions& Options, const TSet<FName>& ExistingPackageNames)
+{
+	// Names are pure string work, so compute them all in parallel and gather the ones that change afterwards
+	TArray<FString> NewNames;
+	NewNames.SetNum(Assets.Num());
+	ParallelFor(Assets.Num(), [&Assets, &Options, &NewNames](int32 AssetIndex)
+	{
+		if (CanRename(Assets[AssetIndex]))
+		{
+			NewNames[AssetIndex] = Options.Apply(Assets[AssetIndex].AssetName.ToString());
+		}
+	});
+
+	TArray<FBatchRenameEntry> Entries;
+	for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+	{
+		const FAssetData& Asset = Assets[AssetIndex];
+		if (!CanRename(Asset) || NewNames[AssetIndex] == Asset.AssetName.ToString())
+		{
+			continue;
+		}
+
+		FBatchRenameEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.AssetData = Asset;
+		Entry.NewName = MoveTemp(NewNames[AssetIndex]);
+	}
+
+	FlagConflicts(Entries, ExistingPackageNames);
+	return Entries;
+}
+
+TArray<FBatchRenameEntry> FBatchRenamer::PlanFromSuggestedNames(const TArray<FLintRuleViolation>& RuleViolations)
+{
+	TArray<FBatchRenameEntry> Entries;
+	TSet<FName> PlannedObjectPaths;
+	TArray<FAssetData> Assets;
+	for (const FLintRuleViolation& Violation : RuleViolations)
+	{
+		if (Violation.SuggestedName.IsEmpty())
+		{
+			continue;
+		}
+
+		const FAssetData Asset = Violation.ViolatorAssetData.IsValid() ? Violation.ViolatorAssetData : FAssetData(Violation.Violator.Get());
+		if (!Asset.IsValid() || !CanRename(Asset) || Violation.SuggestedName == Asset.AssetName.ToString())
+		{
+			continue;
+		}
+
+		bool bAlreadyPlanned = false;
+		PlannedObjectPaths.Add(Asset.ObjectPath, &bAlreadyPlanned);
+		if (bAlreadyPlanned)
+		{
+			continue;
+		}
+
+		FBatchRenameEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.AssetData = Asset;
+		Entry.NewName = Violation.SuggestedName;
+		Assets.Add(Asset);
+	}
+
+	FlagConflicts(Entries, GatherExistingPackageNames(Assets));
+	return Entries;
+}
+
+void FBatchRenamer::FlagConflicts(TArray<FBatchRenameEntry>& Entries, const TSet<FName>& ExistingPackageNames)
+{
+	TMap<FName, int32> NumEntriesByNewPackageName;
+	for (const FBatchRenameEntry& Entry : Entries)
+	{
+		NumEntriesByNewPackageName.FindOrAdd(FName(*(Entry.AssetData.PackagePath.ToString() / Entry.NewName)))++;
+	}
+
+	for (FBatchRenameEntry& Entry : Entries)
+	{
+		const FString NewPackageName = Entry.AssetData.PackagePath.ToString() / Entry.NewName;
+
+		FText InvalidReason;
+		if (Entry.NewName.IsEmpty())
+		{
+			Entry.Conflict = LOCTEXT("ConflictEmptyName", "The new name is empty.");
+		}
+		else if (!FName::IsValidXName(Entry.NewName, INVALID_OBJECTNAME_CHARACTERS INVALID_LONGPACKAGE_CHARACTERS, &InvalidReason))
+		{
+			Entry.Conflict = InvalidReason;
+		}
+		else if (ExistingPackageNames.Contains(FName(*NewPackageName)))
+		{
+			// Includes assets that are themselves being renamed away, since chunks can't guarantee the order they're renamed in
+			Entry.Conflict = LOCTEXT("ConflictExistingAsset", "An asset with this name already exists.");
+		}
+		else if (NumEntriesByNewPackageName.FindChecked(FName(*NewPackageName)) > 1)
+		{
+			Entry.Conflict = LOCTEXT("ConflictOtherRename", "Another selected asset would be renamed to the same name.");
+		}
+	}
+}
+
+bool FBatchRenamer::Execute(const TArray<FBatchRenameEntry>& Entries, int32 ChunkSize /*= DefaultChunkSize*/)
+{
+	TArray<const FBatchRenameEntry*> EntriesToRename;
+	for (const FBatchRenameEntry& Entry : Entries)
+	{
+		if (!Entry.HasConflict())
+		{
+			EntriesToRename.Add(&Entry);
+		}
+	}
+
+	if (EntriesToRename.Num() == 0)
+	{
+		return true;
+	}
+
+	ChunkSize = FMath::Max(ChunkSize, 1);
+
+	IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools")).Get();
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	FScopedSlowTask SlowTask((float)EntriesToRename.Num(), LOCTEXT("BatchRenameProgress", "Renaming assets..."));
+	SlowTask.MakeDialog(/*bShowCancelButton =*/true);
+
+	bool bSuccess = true;
+	int32 NumRenamed = 0;
+	for (int32 ChunkStart = 0; ChunkStart < EntriesToRename.Num(); ChunkStart += ChunkSize)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			UE_LOG(LogLinter, Display, TEXT("Batch rename cancelled after renaming %d of %d assets."), NumRenamed, EntriesToRename.Num());
+			bSuccess = false;
+			break;
+		}
+
+		const int32 ChunkEnd = FMath::Min(ChunkStart + ChunkSize, EntriesToRename.Num());
+		SlowTask.EnterProgressFrame((float)(ChunkEnd - ChunkStart), FText::Format(LOCTEXT("BatchRenameChunkProgress", "Renaming assets {0} to {1} of {2}..."), ChunkStart + 1, ChunkEnd, EntriesToRename.Num()));
+
+		// Only this chunk's assets are loaded
+		TArray<FAssetRenameData> AssetsAndNames;
+		TArray<FName> OldObjectPaths;
+		for (int32 EntryIndex = ChunkStart; EntryIndex < ChunkEnd; ++EntryIndex)
+		{
+			const FBatchRenameEntry& Entry = *EntriesToRename[EntryIndex];
+			UObject* Asset = Entry.AssetData.GetAsset();
+			if (Asset == nullptr)
+			{
+				UE_LOG(LogLinter, Warning, TEXT("Failed to load \"%s\" to rename it."), *Entry.AssetData.ObjectPath.ToString());
+				bSuccess = false;
+				continue;
+			}
+
+			AssetsAndNames.Add(FAssetRenameData(Asset, Entry.AssetData.PackagePath.ToString(), Entry.NewName));
+			OldObjectPaths.Add(Entry.AssetData.ObjectPath);
+		}
+
+		if (!AssetTools.RenameAssets(AssetsAndNames))
+		{
+			bSuccess = false;
+		}
+
+		// Renaming leaves a redirector at every old path that was still referenced; point the referencers at the new names and remove them
+		TArray<UObjectRedirector*> Redirectors;
+		TArray<FName> ChunkPackageNames;
+		for (const FName OldObjectPath : OldObjectPaths)
+		{
+			const FAssetData OldAssetData = AssetRegistry.GetAssetByObjectPath(OldObjectPath);
+			if (OldAssetData.IsValid() && OldAssetData.IsRedirector())
+			{
+				if (UObjectRedirector* Redirector = Cast<UObjectRedirector>(OldAssetData.GetAsset()))
+				{
+					Redirectors.Add(Redirector);
+					AssetRegistry.GetReferencers(OldAssetData.PackageName, ChunkPackageNames);
+				}
+			}
+		}
+
+		if (Redirectors.Num() > 0)
+		{
+			AssetTools.FixupReferencers(Redirectors);
+		}
+
+		TArray<UPackage*> PackagesToSave;
+		for (const FAssetRenameData& AssetAndName : AssetsAndNames)
+		{
+			if (AssetAndName.Asset.IsValid())
+			{
+				PackagesToSave.AddUnique(AssetAndName.Asset->GetOutermost());
+				ChunkPackageNames.AddUnique(AssetAndName.Asset->GetOutermost()->GetFName());
+			}
+		}
+
+		if (PackagesToSave.Num() > 0 && !UEditorLoadingAndSavingUtils::SavePackages(PackagesToSave, /*bOnlyDirty =*/true))
+		{
+			bSuccess = false;
+		}
+
+		NumRenamed += AssetsAndNames.Num();
+
+		// Saved assets are standalone, so this chunk's renamed assets and fixed up referencers have to be unloaded before garbage collection can free them
+		FLintRedirectorFixer::UnloadSavedPackages(ChunkPackageNames);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	UE_LOG(LogLinter, Display, TEXT("Batch renamed %d assets."), NumRenamed);
+	return bSuccess;
+}
+
+#undef LOCTEXT_NAMESPACE
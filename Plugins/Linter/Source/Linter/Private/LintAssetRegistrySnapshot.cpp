@@ -0,0 +1,247 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#include "LintAssetRegistrySnapshot.h"
+#include "AssetRegistryModule.h"
+#include "IAssetRegistry.h"
+#include "AssetRegistryState.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#include "Linter.h"
+
+/** Bump whenever the layout of the snapshot changes, so old snapshots are rescanned instead of misread. */
+static const int32 LintAssetRegistrySnapshotVersion = 2;
+
+/** Everything a full scan gathers, including dependencies and package data, so a restored registry is indistinguishable from a scanned one. */
+static FAssetRegistrySerializationOptions GetSnapshotSerializationOptions()
+{
+	FAssetRegistrySerializationOptions Options;
+	Options.ModifyForDevelopment();
+	return Options;
+}
+
+bool FLintAssetRegistrySnapshot::Load(const FString& Filename, int32& OutNumRescannedPackages)
+{
+	OutNumRescannedPackages = 0;
+
+	TArray<uint8> SnapshotData;
+	if (!FFileHelper::LoadFileToArray(SnapshotData, *Filename, FILEREAD_Silent))
+	{
+		UE_LOG(LogLinter, Display, TEXT("No asset registry snapshot at \"%s\" yet."), *Filename);
+		return false;
+	}
+
+	FMemoryReader Reader(SnapshotData);
+	int32 Version = 0;
+	Reader << Version;
+	if (Version != LintAssetRegistrySnapshotVersion)
+	{
+		UE_LOG(LogLinter, Display, TEXT("Ignoring asset registry snapshot \"%s\" saved by a different version of Linter."), *Filename);
+		return false;
+	}
+
+	TMap<FString, FDateTime> SnapshotTimestamps;
+	Reader << SnapshotTimestamps;
+	if (Reader.IsError())
+	{
+		UE_LOG(LogLinter, Warning, TEXT("Ignoring unreadable asset registry snapshot \"%s\"."), *Filename);
+		return false;
+	}
+
+	// Validate everything before loading anything, so falling back to a full scan starts from a clean registry
+	const TMap<FString, FDateTime> PackageTimestamps = GatherPackageTimestamps();
+	for (const TPair<FString, FDateTime>& SnapshotTimestamp : SnapshotTimestamps)
+	{
+		if (!PackageTimestamps.Contains(SnapshotTimestamp.Key))
+		{
+			// Rescanning can only add to the registry, so a deleted package would linger as a ghost asset
+			UE_LOG(LogLinter, Display, TEXT("Ignoring asset registry snapshot \"%s\" because \"%s\" was deleted since it was saved."), *Filename, *SnapshotTimestamp.Key);
+			return false;
+		}
+	}
+
+	TArray<FString> StaleFilenames;
+	for (const TPair<FString, FDateTime>& PackageTimestamp : PackageTimestamps)
+	{
+		const FDateTime* SnapshotTimestamp = SnapshotTimestamps.Find(PackageTimestamp.Key);
+		if (SnapshotTimestamp == nullptr || *SnapshotTimestamp != PackageTimestamp.Value)
+		{
+			FString StaleFilename;
+			if (FPackageName::DoesPackageExist(PackageTimestamp.Key, nullptr, &StaleFilename))
+			{
+				StaleFilenames.Add(StaleFilename);
+			}
+		}
+	}
+
+	FAssetRegistryState SnapshotState;
+	if (!SnapshotState.Serialize(Reader, GetSnapshotSerializationOptions()) || Reader.IsError())
+	{
+		UE_LOG(LogLinter, Warning, TEXT("Failed to read the asset registry from snapshot \"%s\"."), *Filename);
+		return false;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.AppendState(SnapshotState);
+
+	if (StaleFilenames.Num() > 0)
+	{
+		UE_LOG(LogLinter, Display, TEXT("Rescanning %d packages that changed since the asset registry snapshot was saved..."), StaleFilenames.Num());
+		AssetRegistry.ScanFilesSynchronous(StaleFilenames, /*bForceRescan =*/true);
+	}
+
+	OutNumRescannedPackages = StaleFilenames.Num();
+	return true;
+}
+
+bool FLintAssetRegistrySnapshot::Save(const FString& Filename)
+{
+	TArray<uint8> SnapshotData;
+	FMemoryWriter Writer(SnapshotData);
+
+	int32 Version = LintAssetRegistrySnapshotVersion;
+	Writer << Version;
+
+	TMap<FString, FDateTime> PackageTimestamps = GatherPackageTimestamps();
+	Writer << PackageTimestamps;
+
+	const FAssetRegistrySerializationOptions Options = GetSnapshotSerializationOptions();
+	FAssetRegistryState State;
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get().InitializeTemporaryAssetRegistryState(State, Options);
+	State.Serialize(Writer, Options);
+
+	if (Writer.IsError() || !FFileHelper::SaveArrayToFile(SnapshotData, *Filename))
+	{
+		UE_LOG(LogLinter, Warning, TEXT("Failed to save asset registry snapshot to \"%s\"."), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogLinter, Display, TEXT("Saved asset registry snapshot of %d packages to \"%s\"."), PackageTimestamps.Num(), *Filename);
+	return true;
+}
+
+bool FLintAssetRegistrySnapshot::Verify(const FString& Filename)
+{
+	TArray<uint8> SnapshotData;
+	if (!FFileHelper::LoadFileToArray(SnapshotData, *Filename, FILEREAD_Silent))
+	{
+		UE_LOG(LogLinter, Display, TEXT("No asset registry snapshot at \"%s\" to verify."), *Filename);
+		return true;
+	}
+
+	FMemoryReader Reader(SnapshotData);
+	int32 Version = 0;
+	Reader << Version;
+	if (Version != LintAssetRegistrySnapshotVersion)
+	{
+		UE_LOG(LogLinter, Display, TEXT("Not verifying asset registry snapshot \"%s\" saved by a different version of Linter."), *Filename);
+		return true;
+	}
+
+	const FAssetRegistrySerializationOptions Options = GetSnapshotSerializationOptions();
+	TMap<FString, FDateTime> SnapshotTimestamps;
+	FAssetRegistryState SnapshotState;
+	Reader << SnapshotTimestamps;
+	if (Reader.IsError() || !SnapshotState.Serialize(Reader, Options) || Reader.IsError())
+	{
+		UE_LOG(LogLinter, Error, TEXT("Failed to read asset registry snapshot \"%s\" to verify it."), *Filename);
+		return false;
+	}
+
+	FAssetRegistryState ScannedState;
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get().InitializeTemporaryAssetRegistryState(ScannedState, Options);
+
+	// The class and tags of an asset, in a form that compares equal whichever registry it came from
+	auto GetAssetDescription = [](const FAssetData& Asset)
+	{
+		FString Description = Asset.AssetClass.ToString();
+		for (const TPair<FName, FString>& Tag : Asset.TagsAndValues.CopyMap())
+		{
+			Description += FString::Printf(TEXT("\n%s=%s"), *Tag.Key.ToString(), *Tag.Value);
+		}
+		return Description;
+	};
+
+	auto GetPackageDescription = [&GetAssetDescription](const FAssetRegistryState& State, FName PackageName)
+	{
+		TArray<FString> Lines;
+		for (const FAssetData* Asset : State.GetAssetsByPackageName(PackageName))
+		{
+			Lines.Add(Asset->ObjectPath.ToString() + TEXT(" ") + GetAssetDescription(*Asset));
+		}
+
+		if (const FAssetPackageData* PackageData = State.GetAssetPackageData(PackageName))
+		{
+			Lines.Add(FString::Printf(TEXT("Guid=%s Size=%lld"), *PackageData->PackageGuid.ToString(), PackageData->DiskSize));
+		}
+
+		TArray<FAssetIdentifier> Dependencies;
+		State.GetDependencies(FAssetIdentifier(PackageName), Dependencies);
+		for (const FAssetIdentifier& Dependency : Dependencies)
+		{
+			Lines.Add(TEXT("Dependency ") + Dependency.ToString());
+		}
+
+		Lines.Sort();
+		return FString::Join(Lines, TEXT("\n"));
+	};
+
+	// Only packages untouched since the snapshot was saved are expected to match, the rest would be rescanned by Load
+	const TMap<FString, FDateTime> PackageTimestamps = GatherPackageTimestamps();
+	int32 NumComparedPackages = 0;
+	int32 NumMismatchedPackages = 0;
+	for (const TPair<FString, FDateTime>& SnapshotTimestamp : SnapshotTimestamps)
+	{
+		const FDateTime* PackageTimestamp = PackageTimestamps.Find(SnapshotTimestamp.Key);
+		if (PackageTimestamp == nullptr || *PackageTimestamp != SnapshotTimestamp.Value)
+		{
+			continue;
+		}
+
+		const FName PackageName(*SnapshotTimestamp.Key);
+		NumComparedPackages++;
+		if (GetPackageDescription(SnapshotState, PackageName) != GetPackageDescription(ScannedState, PackageName))
+		{
+			NumMismatchedPackages++;
+			UE_LOG(LogLinter, Warning, TEXT("Asset registry snapshot \"%s\" doesn't match a fresh scan of \"%s\"."), *Filename, *SnapshotTimestamp.Key);
+		}
+	}
+
+	if (NumMismatchedPackages > 0)
+	{
+		UE_LOG(LogLinter, Error, TEXT("%d of %d packages in asset registry snapshot \"%s\" don't match a fresh scan."), NumMismatchedPackages, NumComparedPackages, *Filename);
+		return false;
+	}
+
+	UE_LOG(LogLinter, Display, TEXT("Asset registry snapshot \"%s\" matches a fresh scan of all %d unchanged packages."), *Filename, NumComparedPackages);
+	return true;
+}
+
+TMap<FString, FDateTime> FLintAssetRegistrySnapshot::GatherPackageTimestamps()
+{
+	TMap<FString, FDateTime> PackageTimestamps;
+
+	TArray<FString> RootPackagePaths;
+	FPackageName::QueryRootContentPaths(RootPackagePaths);
+
+	for (const FString& RootPackagePath : RootPackagePaths)
+	{
+		const FString RootDirectory = FPaths::ConvertRelativePathToFull(FPackageName::LongPackageNameToFilename(RootPackagePath));
+
+		// Only stats files, which is far cheaper than the header reads a registry scan does
+		IFileManager::Get().IterateDirectoryStatRecursively(*RootDirectory, [&PackageTimestamps](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+		{
+			FString PackageName;
+			if (!StatData.bIsDirectory && FPackageName::IsPackageExtension(*FPaths::GetExtension(FilenameOrDirectory, /*bIncludeDot =*/true)) && FPackageName::TryConvertFilenameToLongPackageName(FilenameOrDirectory, PackageName))
+			{
+				PackageTimestamps.Add(PackageName, StatData.ModificationTime);
+			}
+			return true;
+		});
+	}
+
+	return PackageTimestamps;
+}
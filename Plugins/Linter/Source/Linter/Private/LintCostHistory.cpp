@@ -0,0 +1,157 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#include "LintCostHistory.h"
+#include "AssetRegistryModule.h"
+#include "IAssetRegistry.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+#include "Linter.h"
+
+FLintCostHistory& FLintCostHistory::Get()
+{
+	static FLintCostHistory Instance;
+	return Instance;
+}
+
+FLintCostHistory::FLintCostHistory()
+{
+	Load();
+}
+
+void FLintCostHistory::RecordDuration(FName PackageName, int64 PackageBytes, double Seconds)
+{
+	FScopeLock ScopeLock(&Lock);
+
+	FPackageCost& Cost = PackageCosts.FindOrAdd(PackageName);
+	TotalSeconds -= Cost.Seconds;
+	TotalBytes -= Cost.Bytes;
+
+	// Average with the previous run, so a single run slowed down by a cold disk doesn't reorder everything
+	Cost.Seconds = Cost.Seconds > 0.0f ? (float)((Cost.Seconds + Seconds) * 0.5) : (float)Seconds;
+	Cost.Bytes = PackageBytes;
+
+	TotalSeconds += Cost.Seconds;
+	TotalBytes += Cost.Bytes;
+	bDirty = true;
+}
+
+double FLintCostHistory::EstimateSeconds(const FAssetData& Asset) const
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (const FPackageCost* Cost = PackageCosts.Find(Asset.PackageName))
+		{
+			return Cost->Seconds;
+		}
+	}
+
+	return GetPackageBytes(Asset.PackageName) * GetAverageSecondsPerByte();
+}
+
+void FLintCostHistory::SortLongestFirst(TArray<FAssetData>& AssetList) const
+{
+	check(IsInGameThread());
+
+	TArray<TPair<double, int32>> EstimatesAndIndices;
+	EstimatesAndIndices.Reserve(AssetList.Num());
+	for (int32 AssetIndex = 0; AssetIndex < AssetList.Num(); ++AssetIndex)
+	{
+		EstimatesAndIndices.Emplace(EstimateSeconds(AssetList[AssetIndex]), AssetIndex);
+	}
+
+	EstimatesAndIndices.StableSort([](const TPair<double, int32>& A, const TPair<double, int32>& B) { return A.Key > B.Key; });
+
+	TArray<FAssetData> SortedAssetList;
+	SortedAssetList.Reserve(AssetList.Num());
+	for (const TPair<double, int32>& EstimateAndIndex : EstimatesAndIndices)
+	{
+		SortedAssetList.Add(MoveTemp(AssetList[EstimateAndIndex.Value]));
+	}
+	AssetList = MoveTemp(SortedAssetList);
+}
+
+void FLintCostHistory::SaveIfDirty()
+{
+	FScopeLock ScopeLock(&Lock);
+	if (!bDirty)
+	{
+		return;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> PackageJsonValues;
+	for (const TPair<FName, FPackageCost>& PackagePair : PackageCosts)
+	{
+		TSharedPtr<FJsonObject> PackageJsonObject = MakeShareable(new FJsonObject);
+		PackageJsonObject->SetStringField(TEXT("Package"), PackagePair.Key.ToString());
+		PackageJsonObject->SetNumberField(TEXT("Seconds"), PackagePair.Value.Seconds);
+		PackageJsonObject->SetNumberField(TEXT("Bytes"), (double)PackagePair.Value.Bytes);
+		PackageJsonValues.Add(MakeShareable(new FJsonValueObject(PackageJsonObject)));
+	}
+
+	TSharedPtr<FJsonObject> RootJsonObject = MakeShareable(new FJsonObject);
+	RootJsonObject->SetArrayField(TEXT("Packages"), PackageJsonValues);
+
+	FString HistoryString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&HistoryString);
+	FJsonSerializer::Serialize(RootJsonObject.ToSharedRef(), Writer);
+
+	if (FFileHelper::SaveStringToFile(HistoryString, *GetHistoryFilename()))
+	{
+		bDirty = false;
+	}
+	else
+	{
+		UE_LOG(LogLinter, Warning, TEXT("Failed to save lint cost history to \"%s\"."), *GetHistoryFilename());
+	}
+}
+
+int64 FLintCostHistory::GetPackageBytes(FName PackageName)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	const FAssetPackageData* PackageData = AssetRegistry.GetAssetPackageData(PackageName);
+	return PackageData != nullptr ? FMath::Max<int64>(PackageData->DiskSize, 0) : 0;
+}
+
+FString FLintCostHistory::GetHistoryFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Linter") / TEXT("LintCostHistory.json");
+}
+
+void FLintCostHistory::Load()
+{
+	FString HistoryString;
+	if (!FFileHelper::LoadFileToString(HistoryString, *GetHistoryFilename()))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> RootJsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(HistoryString);
+	if (!FJsonSerializer::Deserialize(Reader, RootJsonObject) || !RootJsonObject.IsValid())
+	{
+		UE_LOG(LogLinter, Warning, TEXT("Ignoring unreadable lint cost history \"%s\"."), *GetHistoryFilename());
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& PackageJsonValue : RootJsonObject->GetArrayField(TEXT("Packages")))
+	{
+		const TSharedPtr<FJsonObject>& PackageJsonObject = PackageJsonValue->AsObject();
+		FPackageCost& Cost = PackageCosts.FindOrAdd(FName(*PackageJsonObject->GetStringField(TEXT("Package"))));
+		Cost.Seconds = (float)PackageJsonObject->GetNumberField(TEXT("Seconds"));
+		Cost.Bytes = (int64)PackageJsonObject->GetNumberField(TEXT("Bytes"));
+		TotalSeconds += Cost.Seconds;
+		TotalBytes += Cost.Bytes;
+	}
+}
+
+double FLintCostHistory::GetAverageSecondsPerByte() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return TotalBytes > 0 && TotalSeconds > 0.0 ? TotalSeconds / (double)TotalBytes : DefaultSecondsPerByte;
+}
@@ -0,0 +1,175 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#include "LintIdleSweeper.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Editor.h"
+
+#include "Linter.h"
+#include "LinterSettings.h"
+#include "LintRuleSet.h"
+#include "LintResultCache.h"
+
+namespace LintIdleSweeper
+{
+	/** Never let saved up budget turn into a long hitch. */
+	static const double MaxTimeBudget = 0.1;
+
+	/** Once everything has been swept, wait this long before looking for stale assets again. */
+	static const double SecondsBetweenPasses = 600.0;
+
+	/** How many assets to lint between checkpoints. */
+	static const int32 AssetsPerCheckpoint = 25;
+}
+
+FLintIdleSweeper::FLintIdleSweeper()
+{
+	LoadCheckpoint();
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FLintIdleSweeper::Tick));
+}
+
+FLintIdleSweeper::~FLintIdleSweeper()
+{
+	FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+
+	if (NumLintedSinceCheckpoint > 0)
+	{
+		SaveCheckpoint();
+	}
+}
+
+bool FLintIdleSweeper::Tick(float DeltaTime)
+{
+	const ULinterSettings* Settings = GetDefault<ULinterSettings>();
+	if (!Settings->bIdleSweep || !IsEditorIdle())
+	{
+		TimeBudget = 0.0;
+		return true;
+	}
+
+	TimeBudget = FMath::Min(TimeBudget + DeltaTime * FMath::Clamp(Settings->IdleSweepMaxCPUPercent, 1, 100) / 100.0, LintIdleSweeper::MaxTimeBudget);
+	if (TimeBudget <= 0.0)
+	{
+		return true;
+	}
+
+	if (PassAssets.Num() == 0)
+	{
+		if (FPlatformTime::Seconds() - LastPassFinishedTime < LintIdleSweeper::SecondsBetweenPasses)
+		{
+			return true;
+		}
+
+		StartPass();
+	}
+
+	const ULintRuleSet* RuleSet = GetDefault<ULinterSettings>()->DefaultLintRuleSet.LoadSynchronous();
+	if (RuleSet == nullptr)
+	{
+		return true;
+	}
+
+	FLintResultCache& ResultCache = FLintResultCache::Get();
+
+	// A single asset can't be interrupted, so a slow one simply puts the budget in debt until real time pays it back
+	while (TimeBudget > 0.0 && NextAssetIndex < PassAssets.Num() && IsEditorIdle())
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		const FAssetData& Asset = PassAssets[NextAssetIndex++];
+		if (!ResultCache.IsUpToDate(RuleSet, Asset.PackageName))
+		{
+			const TArray<FAssetData> AssetList({ Asset });
+			ResultCache.StoreResults(RuleSet, AssetList, RuleSet->LintAssets(AssetList));
+			NumLintedSinceCheckpoint++;
+		}
+
+		CheckpointPackageName = Asset.PackageName;
+		TimeBudget -= FPlatformTime::Seconds() - StartTime;
+
+		if (NumLintedSinceCheckpoint >= LintIdleSweeper::AssetsPerCheckpoint)
+		{
+			SaveCheckpoint();
+		}
+	}
+
+	if (NextAssetIndex >= PassAssets.Num())
+	{
+		FinishPass();
+	}
+
+	return true;
+}
+
+bool FLintIdleSweeper::IsEditorIdle() const
+{
+	if (!FSlateApplication::IsInitialized() || GIsSlowTask || GIsPlayInEditorWorld || (GEditor != nullptr && GEditor->PlayWorld != nullptr))
+	{
+		return false;
+	}
+
+	const ULinterSettings* Settings = GetDefault<ULinterSettings>();
+	FSlateApplication& SlateApplication = FSlateApplication::Get();
+	if (SlateApplication.GetCurrentTime() - SlateApplication.GetLastUserInteractionTime() < Settings->IdleSweepDelay)
+	{
+		return false;
+	}
+
+	// Leave the editor alone while something else is keeping it busy, i.e. compiling or building lighting
+	return FPlatformTime::GetCPUTime().CPUTimePctRelative < Settings->IdleSweepBusyCPUPercent;
+}
+
+void FLintIdleSweeper::StartPass()
+{
+	UE_LOG(LogLinter, Verbose, TEXT("Starting idle lint sweep of /Game."));
+
+	PassAssets = ULintRuleSet::GatherAssetsInPaths(TArray<FString>({ TEXT("/Game") }));
+	PassAssets.Sort([](const FAssetData& A, const FAssetData& B)
+	{
+		return A.PackageName.LexicalLess(B.PackageName) || (A.PackageName == B.PackageName && A.AssetName.LexicalLess(B.AssetName));
+	});
+
+	// Resume after the last package a previous session got to
+	NextAssetIndex = 0;
+	if (!CheckpointPackageName.IsNone())
+	{
+		while (NextAssetIndex < PassAssets.Num() && !CheckpointPackageName.LexicalLess(PassAssets[NextAssetIndex].PackageName))
+		{
+			NextAssetIndex++;
+		}
+	}
+}
+
+void FLintIdleSweeper::FinishPass()
+{
+	UE_LOG(LogLinter, Verbose, TEXT("Finished idle lint sweep of /Game."));
+
+	PassAssets.Reset();
+	NextAssetIndex = 0;
+	CheckpointPackageName = NAME_None;
+	LastPassFinishedTime = FPlatformTime::Seconds();
+	SaveCheckpoint();
+}
+
+void FLintIdleSweeper::LoadCheckpoint()
+{
+	FString Checkpoint;
+	if (FFileHelper::LoadFileToString(Checkpoint, *GetCheckpointFilename()))
+	{
+		Checkpoint.TrimStartAndEndInline();
+		CheckpointPackageName = Checkpoint.IsEmpty() ? NAME_None : FName(*Checkpoint);
+	}
+}
+
+void FLintIdleSweeper::SaveCheckpoint()
+{
+	FFileHelper::SaveStringToFile(CheckpointPackageName.IsNone() ? FString() : CheckpointPackageName.ToString(), *GetCheckpointFilename());
+	FLintResultCache::Get().SaveIfDirty();
+	NumLintedSinceCheckpoint = 0;
+}
+
+FString FLintIdleSweeper::GetCheckpointFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Linter") / TEXT("IdleSweepCheckpoint.txt");
+}
@@ -0,0 +1,175 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#include "LintOnSaveWatcher.h"
+#include "AssetRegistryModule.h"
+#include "IAssetRegistry.h"
+#include "Framework/Docking/TabManager.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include "UObject/Package.h"
+#include "Misc/Paths.h"
+
+#include "Linter.h"
+#include "LinterSettings.h"
+#include "LintRuleSet.h"
+#include "AsyncLintJob.h"
+#include "LintResultCache.h"
+
+#define LOCTEXT_NAMESPACE "Linter"
+
+FLintOnSaveWatcher::FLintOnSaveWatcher()
+{
+	PackageSavedDelegateHandle = UPackage::PackageSavedEvent.AddRaw(this, &FLintOnSaveWatcher::OnPackageSaved);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetAddedDelegateHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FLintOnSaveWatcher::OnAssetAdded);
+	AssetRenamedDelegateHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FLintOnSaveWatcher::OnAssetRenamed);
+
+	TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FLintOnSaveWatcher::Tick), 0.25f);
+}
+
+FLintOnSaveWatcher::~FLintOnSaveWatcher()
+{
+	FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	UPackage::PackageSavedEvent.Remove(PackageSavedDelegateHandle);
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		AssetRegistryModule->Get().OnAssetAdded().Remove(AssetAddedDelegateHandle);
+		AssetRegistryModule->Get().OnAssetRenamed().Remove(AssetRenamedDelegateHandle);
+	}
+
+	LintJob.Reset();
+}
+
+void FLintOnSaveWatcher::OnPackageSaved(const FString& PackageFileName, UObject* Outer)
+{
+	// Autosaves write copies of packages under Saved, those aren't the assets people are working on
+	UPackage* Package = Cast<UPackage>(Outer);
+	if (Package != nullptr && !FPaths::IsUnderDirectory(FPaths::ConvertRelativePathToFull(PackageFileName), FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir())))
+	{
+		QueuePackage(Package->GetFName());
+	}
+}
+
+void FLintOnSaveWatcher::OnAssetAdded(const FAssetData& AssetData)
+{
+	// Every asset is "added" while the registry does its initial scan
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	if (!AssetRegistry.IsLoadingAssets())
+	{
+		QueuePackage(AssetData.PackageName);
+	}
+}
+
+void FLintOnSaveWatcher::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	QueuePackage(AssetData.PackageName);
+}
+
+void FLintOnSaveWatcher::QueuePackage(FName PackageName)
+{
+	if (!GetDefault<ULinterSettings>()->bLintOnSave || !PackageName.ToString().StartsWith(TEXT("/Game/")))
+	{
+		return;
+	}
+
+	PendingPackageNames.Add(PackageName);
+	LastEventTime = FPlatformTime::Seconds();
+}
+
+bool FLintOnSaveWatcher::Tick(float DeltaTime)
+{
+	if (LintJob.IsValid())
+	{
+		LintJob->DrainResults(LintJobRuleViolations, &LintJobLintedAssets);
+		if (LintJob->IsFinished())
+		{
+			FinishLintJob();
+		}
+	}
+	else if (PendingPackageNames.Num() > 0 && FPlatformTime::Seconds() - LastEventTime >= GetDefault<ULinterSettings>()->LintOnSaveDelay)
+	{
+		StartLintJob();
+	}
+
+	return true;
+}
+
+void FLintOnSaveWatcher::StartLintJob()
+{
+	const ULintRuleSet* RuleSet = GetDefault<ULinterSettings>()->DefaultLintRuleSet.LoadSynchronous();
+	if (RuleSet == nullptr)
+	{
+		UE_LOG(LogLinter, Warning, TEXT("Lint on save is enabled but no default lint rule set is configured."));
+		PendingPackageNames.Reset();
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	TArray<FAssetData> AssetList;
+	for (const FName PackageName : PendingPackageNames)
+	{
+		AssetRegistry.GetAssetsByPackageName(PackageName, AssetList);
+	}
+	PendingPackageNames.Reset();
+
+	if (AssetList.Num() == 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogLinter, Verbose, TEXT("Linting %d saved, imported or renamed assets."), AssetList.Num());
+
+	LintJobRuleViolations.Reset();
+	LintJobLintedAssets.Reset();
+	LintJobRuleSet = RuleSet;
+	LintJob = MakeShareable(new FAsyncLintJob(RuleSet, AssetList));
+	LintJob->Start();
+}
+
+void FLintOnSaveWatcher::FinishLintJob()
+{
+	const int32 NumAssets = LintJob->GetNumAssets();
+	LintJob.Reset();
+
+	FLintResultCache::Get().StoreResults(LintJobRuleSet.Get(), LintJobLintedAssets, LintJobRuleViolations);
+	LintJobLintedAssets.Reset();
+
+	int32 NumErrors = 0;
+	int32 NumWarnings = 0;
+	TSet<FName> Violators;
+	for (const FLintRuleViolation& Violation : LintJobRuleViolations)
+	{
+		const ULintRule* LintRule = Violation.ViolatedRule->GetDefaultObject<ULintRule>();
+		if (LintRule->RuleSeverity <= ELintRuleSeverity::Error)
+		{
+			NumErrors++;
+		}
+		else
+		{
+			NumWarnings++;
+		}
+
+		if (Violation.Violator.IsValid())
+		{
+			Violators.Add(Violation.Violator->GetFName());
+			UE_LOG(LogLinter, Warning, TEXT("%s: %s %s"), *Violation.Violator->GetPathName(), *LintRule->RuleTitle.ToString(), *Violation.RecommendedAction.ToString());
+		}
+	}
+	LintJobRuleViolations.Reset();
+
+	if (NumErrors + NumWarnings == 0)
+	{
+		return;
+	}
+
+	FNotificationInfo NotificationInfo(FText::FormatNamed(LOCTEXT("LintOnSaveResults", "Linter found {NumErrors} {NumErrors}|plural(one=error,other=errors) and {NumWarnings} {NumWarnings}|plural(one=warning,other=warnings) in {NumViolators} of {NumAssets} changed {NumAssets}|plural(one=asset,other=assets)."),
+		TEXT("NumErrors"), NumErrors, TEXT("NumWarnings"), NumWarnings, TEXT("NumViolators"), Violators.Num(), TEXT("NumAssets"), NumAssets));
+	NotificationInfo.ExpireDuration = 6.0f;
+	NotificationInfo.Hyperlink = FSimpleDelegate::CreateStatic([]() { FGlobalTabmanager::Get()->InvokeTab(FName("LinterTab")); });
+	NotificationInfo.HyperlinkText = LOCTEXT("LintOnSaveOpenLinter", "Open Linter");
+	FSlateNotificationManager::Get().AddNotification(NotificationInfo);
+}
+
+#undef LOCTEXT_NAMESPACE
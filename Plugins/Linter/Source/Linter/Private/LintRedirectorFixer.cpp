@@ -0,0 +1,215 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#include "LintRedirectorFixer.h"
+#include "AssetRegistryModule.h"
+#include "IAssetRegistry.h"
+#include "AssetToolsModule.h"
+#include "IAssetTools.h"
+#include "Editor.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Modules/ModuleManager.h"
+#include "PackageTools.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/ObjectRedirector.h"
+
+#include "Linter.h"
+
+#define LOCTEXT_NAMESPACE "LintRedirectorFixer"
+
+TArray<FLintRedirectorBatch> FLintRedirectorFixer::PlanBatches(const TArray<FAssetData>& Redirectors, int64 MaxBatchBytes)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	// Every redirector and referencing package is a node of a union find, so redirectors that share a referencer,
+	// or reference each other as part of a chain, end up in the same group
+	TMap<FName, int32> NodeIndices;
+	TArray<int32> Parents;
+	auto FindOrAddNode = [&NodeIndices, &Parents](FName PackageName)
+	{
+		if (const int32* NodeIndex = NodeIndices.Find(PackageName))
+		{
+			return *NodeIndex;
+		}
+
+		const int32 NodeIndex = Parents.Add(Parents.Num());
+		NodeIndices.Add(PackageName, NodeIndex);
+		return NodeIndex;
+	};
+	auto FindRoot = [&Parents](int32 NodeIndex)
+	{
+		while (Parents[NodeIndex] != NodeIndex)
+		{
+			Parents[NodeIndex] = Parents[Parents[NodeIndex]];
+			NodeIndex = Parents[NodeIndex];
+		}
+		return NodeIndex;
+	};
+
+	TArray<TArray<FName>> ReferencersByRedirector;
+	ReferencersByRedirector.SetNum(Redirectors.Num());
+	for (int32 RedirectorIndex = 0; RedirectorIndex < Redirectors.Num(); ++RedirectorIndex)
+	{
+		const int32 RedirectorNode = FindOrAddNode(Redirectors[RedirectorIndex].PackageName);
+		AssetRegistry.GetReferencers(Redirectors[RedirectorIndex].PackageName, ReferencersByRedirector[RedirectorIndex]);
+		for (const FName Referencer : ReferencersByRedirector[RedirectorIndex])
+		{
+			const int32 ReferencerRoot = FindRoot(FindOrAddNode(Referencer));
+			Parents[ReferencerRoot] = FindRoot(RedirectorNode);
+		}
+	}
+
+	// Groups keep the order their first redirector was found in, so the same project always gets the same batches
+	TArray<FLintRedirectorBatch> Groups;
+	TMap<int32, int32> GroupIndicesByRoot;
+	for (int32 RedirectorIndex = 0; RedirectorIndex < Redirectors.Num(); ++RedirectorIndex)
+	{
+		const int32 Root = FindRoot(NodeIndices.FindChecked(Redirectors[RedirectorIndex].PackageName));
+		int32& GroupIndex = GroupIndicesByRoot.FindOrAdd(Root, INDEX_NONE);
+		if (GroupIndex == INDEX_NONE)
+		{
+			GroupIndex = Groups.AddDefaulted();
+		}
+
+		FLintRedirectorBatch& Group = Groups[GroupIndex];
+		Group.Redirectors.Add(Redirectors[RedirectorIndex]);
+		Group.ReferencingPackages.Append(ReferencersByRedirector[RedirectorIndex]);
+	}
+
+	for (FLintRedirectorBatch& Group : Groups)
+	{
+		for (const FName ReferencingPackage : Group.ReferencingPackages)
+		{
+			if (const FAssetPackageData* PackageData = AssetRegistry.GetAssetPackageData(ReferencingPackage))
+			{
+				Group.EstimatedBytes += FMath::Max<int64>(PackageData->DiskSize, 0);
+			}
+		}
+	}
+
+	// Groups never share a referencing package, so their sizes simply add up
+	TArray<FLintRedirectorBatch> Batches;
+	for (FLintRedirectorBatch& Group : Groups)
+	{
+		if (Batches.Num() == 0 || Batches.Last().EstimatedBytes + Group.EstimatedBytes > MaxBatchBytes)
+		{
+			Batches.AddDefaulted();
+		}
+
+		FLintRedirectorBatch& Batch = Batches.Last();
+		Batch.Redirectors.Append(MoveTemp(Group.Redirectors));
+		Batch.ReferencingPackages.Append(MoveTemp(Group.ReferencingPackages));
+		Batch.EstimatedBytes += Group.EstimatedBytes;
+	}
+
+	return Batches;
+}
+
+FLintRedirectorFixupResult FLintRedirectorFixer::FixUpRedirectorsInPath(FName PackagePath, int64 MaxBatchBytes)
+{
+	FLintRedirectorFixupResult Result;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools")).Get();
+
+	FARFilter Filter;
+	Filter.bRecursivePaths = true;
+	Filter.PackagePaths.Add(PackagePath);
+	Filter.ClassNames.Add(UObjectRedirector::StaticClass()->GetFName());
+
+	TArray<FAssetData> Redirectors;
+	AssetRegistry.GetAssets(Filter, Redirectors);
+	Result.NumRedirectors = Redirectors.Num();
+	if (Redirectors.Num() == 0)
+	{
+		return Result;
+	}
+
+	const TArray<FLintRedirectorBatch> Batches = PlanBatches(Redirectors, MaxBatchBytes);
+	UE_LOG(LogLinter, Display, TEXT("Fixing up %d redirectors under %s in %d batches."), Redirectors.Num(), *PackagePath.ToString(), Batches.Num());
+
+	FScopedSlowTask SlowTask((float)Redirectors.Num(), LOCTEXT("FixingUpRedirectors", "Fixing up redirectors..."));
+
+	for (int32 BatchIndex = 0; BatchIndex < Batches.Num(); ++BatchIndex)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			UE_LOG(LogLinter, Display, TEXT("Redirector fix up cancelled after %d of %d batches. Run it again to continue."), BatchIndex, Batches.Num());
+			Result.bCancelled = true;
+			break;
+		}
+
+		const FLintRedirectorBatch& Batch = Batches[BatchIndex];
+		SlowTask.EnterProgressFrame((float)Batch.Redirectors.Num(), FText::Format(LOCTEXT("FixingUpRedirectorsBatch", "Fixing up redirectors: batch {0} of {1}, {2} referencing packages..."), BatchIndex + 1, Batches.Num(), Batch.ReferencingPackages.Num()));
+
+		// Only this batch's redirectors are loaded; FixupReferencers loads and saves their referencers, which are unloaded below
+		TArray<UObjectRedirector*> LoadedRedirectors;
+		for (const FAssetData& Redirector : Batch.Redirectors)
+		{
+			if (UObjectRedirector* LoadedRedirector = LoadObject<UObjectRedirector>(nullptr, *Redirector.ObjectPath.ToString()))
+			{
+				LoadedRedirectors.Add(LoadedRedirector);
+			}
+			else
+			{
+				UE_LOG(LogLinter, Warning, TEXT("Failed to load redirector \"%s\" to fix it up."), *Redirector.ObjectPath.ToString());
+				Result.NumFailedToLoad++;
+			}
+		}
+
+		if (LoadedRedirectors.Num() > 0)
+		{
+			AssetTools.FixupReferencers(LoadedRedirectors);
+		}
+
+		// Redirectors are only deleted once every referencer was saved, so whatever is left failed and will be retried next run
+		for (const FAssetData& Redirector : Batch.Redirectors)
+		{
+			if (!AssetRegistry.GetAssetByObjectPath(Redirector.ObjectPath).IsValid())
+			{
+				Result.NumFixedUp++;
+			}
+		}
+
+		UnloadSavedPackages(Batch.ReferencingPackages.Array());
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	UE_LOG(LogLinter, Display, TEXT("Fixed up %d of %d redirectors under %s."), Result.NumFixedUp, Result.NumRedirectors, *PackagePath.ToString());
+	return Result;
+}
+
+int32 FLintRedirectorFixer::UnloadSavedPackages(const TArray<FName>& PackageNames)
+{
+	UAssetEditorSubsystem* AssetEditorSubsystem = GEditor != nullptr ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+	const UWorld* EditorWorld = GEditor != nullptr ? GEditor->GetEditorWorldContext().World() : nullptr;
+
+	TArray<UPackage*> PackagesToUnload;
+	for (const FName PackageName : PackageNames)
+	{
+		UPackage* Package = FindPackage(nullptr, *PackageName.ToString());
+		if (Package == nullptr || Package->IsDirty() || (EditorWorld != nullptr && EditorWorld->GetOutermost() == Package))
+		{
+			continue;
+		}
+
+		TArray<UObject*> PackageObjects;
+		GetObjectsWithOuter(Package, PackageObjects, /*bIncludeNestedObjects =*/false);
+		const bool bOpenInEditor = AssetEditorSubsystem != nullptr && PackageObjects.ContainsByPredicate([AssetEditorSubsystem](UObject* Object)
+		{
+			return AssetEditorSubsystem->FindEditorForAsset(Object, /*bFocusIfOpen =*/false) != nullptr;
+		});
+
+		if (!bOpenInEditor)
+		{
+			PackagesToUnload.Add(Package);
+		}
+	}
+
+	if (PackagesToUnload.Num() > 0)
+	{
+		UPackageTools::UnloadPackages(PackagesToUnload);
+	}
+
+	return PackagesToUnload.Num();
+}
+
+#undef LOCTEXT_NAMESPACE
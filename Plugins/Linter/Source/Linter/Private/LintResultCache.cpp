@@ -0,0 +1,458 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#include "LintResultCache.h"
+#include "AssetRegistryModule.h"
+#include "IAssetRegistry.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/PackageName.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+#include "Interfaces/IPluginManager.h"
+
+#include "Linter.h"
+#include "LintRuleSet.h"
+
+/** Bump whenever the cache format or what goes into a cached result changes. */
+static const int32 LintResultCacheVersion = 2;
+
+/** The installed Linter's version, since native rules can change with it without any package being saved. */
+static int32 GetLinterVersion()
+{
+	TSharedPtr<IPlugin> LinterPlugin = IPluginManager::Get().FindPlugin(TEXT("Linter"));
+	return LinterPlugin.IsValid() ? LinterPlugin->GetDescriptor().Version : 0;
+}
+
+FLintResultCache& FLintResultCache::Get()
+{
+	static FLintResultCache Instance;
+	return Instance;
+}
+
+FLintResultCache::FLintResultCache()
+{
+	Load();
+}
+
+void FLintResultCache::StoreResults(const ULintRuleSet* RuleSet, const TArray<FAssetData>& LintedAssets, const TArray<FLintRuleViolation>& RuleViolations)
+{
+	check(IsInGameThread());
+
+	if (RuleSet == nullptr || LintedAssets.Num() == 0)
+	{
+		return;
+	}
+
+	// Any change to the rule set, its naming convention or its Blueprint rules may change every result
+	const TMap<FName, FGuid> DependencyGuids = GetDependencyGuids(RuleSet);
+	FCachedRuleSet& CachedRuleSet = RuleSets.FindOrAdd(FName(*RuleSet->GetPathName()));
+	if (!CachedRuleSet.DependencyGuids.OrderIndependentCompareEqual(DependencyGuids))
+	{
+		CachedRuleSet.DependencyGuids = DependencyGuids;
+		CachedRuleSet.Packages.Reset();
+		CachedRuleSet.Folders.Reset();
+		CachedRuleSet.FolderIndices.Reset();
+	}
+
+	// Take the old counts of every linted package out of the folder totals, they're added back once recounted below
+	TSet<FName> LintedPackages;
+	for (const FAssetData& Asset : LintedAssets)
+	{
+		bool bAlreadyInSet = false;
+		LintedPackages.Add(Asset.PackageName, &bAlreadyInSet);
+		if (const FCachedPackage* CachedPackage = !bAlreadyInSet ? CachedRuleSet.Packages.Find(Asset.PackageName) : nullptr)
+		{
+			RollUpPackage(CachedRuleSet, Asset.PackageName, -CachedPackage->NumErrors, -CachedPackage->NumWarnings);
+		}
+	}
+
+	// Start every linted package over, then add back whatever violations were found
+	for (const FAssetData& Asset : LintedAssets)
+	{
+		const FGuid PackageGuid = GetPackageGuid(Asset.PackageName);
+		if (!PackageGuid.IsValid())
+		{
+			CachedRuleSet.Packages.Remove(Asset.PackageName);
+			continue;
+		}
+
+		FCachedPackage& CachedPackage = CachedRuleSet.Packages.FindOrAdd(Asset.PackageName);
+		if (CachedPackage.PackageGuid != PackageGuid)
+		{
+			CachedPackage = FCachedPackage();
+			CachedPackage.PackageGuid = PackageGuid;
+		}
+		else
+		{
+			// Packages with several assets keep the results of the assets that weren't linted this time
+			CachedPackage.Violations.RemoveAll([&Asset](const FCachedViolation& Violation) { return Violation.ObjectPath == Asset.ObjectPath; });
+		}
+	}
+
+	// Violations found by other rule sets in the same run belong to their own entries
+	const FName RuleSetName = RuleSet->GetReportName();
+	for (const FLintRuleViolation& Violation : RuleViolations)
+	{
+		if (!Violation.RuleSetName.IsNone() && Violation.RuleSetName != RuleSetName)
+		{
+			continue;
+		}
+
+		const FAssetData& ViolatorAssetData = Violation.ViolatorAssetData.IsValid() ? Violation.ViolatorAssetData : FAssetData(Violation.Violator.Get());
+		FCachedPackage* CachedPackage = CachedRuleSet.Packages.Find(ViolatorAssetData.PackageName);
+		if (CachedPackage == nullptr || Violation.ViolatedRule == nullptr)
+		{
+			continue;
+		}
+
+		FCachedViolation& CachedViolation = CachedPackage->Violations.AddDefaulted_GetRef();
+		CachedViolation.ObjectPath = ViolatorAssetData.ObjectPath;
+		CachedViolation.RuleClass = FSoftClassPath(Violation.ViolatedRule.Get());
+		CachedViolation.RecommendedAction = Violation.RecommendedAction.ToString();
+		CachedViolation.SuggestedName = Violation.SuggestedName;
+	}
+
+	for (const FName PackageName : LintedPackages)
+	{
+		if (FCachedPackage* CachedPackage = CachedRuleSet.Packages.Find(PackageName))
+		{
+			CachedPackage->NumErrors = 0;
+			CachedPackage->NumWarnings = 0;
+			for (const FCachedViolation& CachedViolation : CachedPackage->Violations)
+			{
+				UClass* RuleClass = CachedViolation.RuleClass.ResolveClass();
+				const ULintRule* LintRule = RuleClass != nullptr ? RuleClass->GetDefaultObject<ULintRule>() : nullptr;
+				if (LintRule != nullptr && LintRule->RuleSeverity <= ELintRuleSeverity::Error)
+				{
+					CachedPackage->NumErrors++;
+				}
+				else if (LintRule != nullptr && LintRule->RuleSeverity <= ELintRuleSeverity::Warning)
+				{
+					CachedPackage->NumWarnings++;
+				}
+			}
+
+			RollUpPackage(CachedRuleSet, PackageName, CachedPackage->NumErrors, CachedPackage->NumWarnings);
+		}
+	}
+
+	bDirty = true;
+	ResultsChangedEvent.Broadcast();
+}
+
+bool FLintResultCache::IsUpToDate(const ULintRuleSet* RuleSet, FName PackageName) const
+{
+	const FCachedRuleSet* CachedRuleSet = FindRuleSet(RuleSet);
+	if (CachedRuleSet == nullptr)
+	{
+		return false;
+	}
+
+	const FCachedPackage* CachedPackage = CachedRuleSet->Packages.Find(PackageName);
+	return CachedPackage != nullptr && CachedPackage->PackageGuid == GetPackageGuid(PackageName);
+}
+
+void FLintResultCache::TakeUpToDateResults(const ULintRuleSet* RuleSet, TArray<FAssetData>& InOutAssetList, TArray<FLintRuleViolation>& OutRuleViolations) const
+{
+	const FCachedRuleSet* CachedRuleSet = FindRuleSet(RuleSet);
+	if (CachedRuleSet == nullptr)
+	{
+		return;
+	}
+
+	TSet<FName> TakenPackages;
+	InOutAssetList.RemoveAll([this, CachedRuleSet, &TakenPackages](const FAssetData& Asset)
+	{
+		const FCachedPackage* CachedPackage = CachedRuleSet->Packages.Find(Asset.PackageName);
+		if (CachedPackage == nullptr || CachedPackage->PackageGuid != GetPackageGuid(Asset.PackageName))
+		{
+			return false;
+		}
+
+		TakenPackages.Add(Asset.PackageName);
+		return true;
+	});
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	const FName RuleSetName = RuleSet->GetReportName();
+
+	for (const FName PackageName : TakenPackages)
+	{
+		for (const FCachedViolation& CachedViolation : CachedRuleSet->Packages[PackageName].Violations)
+		{
+			UClass* RuleClass = CachedViolation.RuleClass.TryLoadClass<ULintRule>();
+			if (RuleClass == nullptr)
+			{
+				continue;
+			}
+
+			// The violator isn't loaded, so only its asset data is filled in
+			FLintRuleViolation& Violation = OutRuleViolations.Emplace_GetRef(nullptr, RuleClass, FText::FromString(CachedViolation.RecommendedAction));
+			Violation.ViolatorAssetData = AssetRegistry.GetAssetByObjectPath(CachedViolation.ObjectPath);
+			Violation.SuggestedName = CachedViolation.SuggestedName;
+			Violation.RuleSetName = RuleSetName;
+		}
+	}
+}
+
+FLintStatusCounts FLintResultCache::GetPackageStatus(FName RuleSetPath, FName PackageName) const
+{
+	FLintStatusCounts Status;
+
+	const FCachedRuleSet* CachedRuleSet = FindRuleSet(RuleSetPath);
+	const FCachedPackage* CachedPackage = CachedRuleSet != nullptr ? CachedRuleSet->Packages.Find(PackageName) : nullptr;
+	if (CachedPackage != nullptr)
+	{
+		Status.NumErrors = CachedPackage->NumErrors;
+		Status.NumWarnings = CachedPackage->NumWarnings;
+		Status.bUpToDate = CachedPackage->PackageGuid == GetPackageGuid(PackageName);
+	}
+
+	return Status;
+}
+
+FLintStatusCounts FLintResultCache::GetFolderStatus(FName RuleSetPath, FName FolderPath) const
+{
+	FLintStatusCounts Status;
+
+	const FCachedRuleSet* CachedRuleSet = FindRuleSet(RuleSetPath);
+	const int32* FolderIndex = CachedRuleSet != nullptr ? CachedRuleSet->FolderIndices.Find(FolderPath) : nullptr;
+	if (FolderIndex != nullptr)
+	{
+		Status.NumErrors = CachedRuleSet->Folders[*FolderIndex].NumErrors;
+		Status.NumWarnings = CachedRuleSet->Folders[*FolderIndex].NumWarnings;
+	}
+
+	return Status;
+}
+
+void FLintResultCache::SaveIfDirty()
+{
+	if (!bDirty)
+	{
+		return;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> RuleSetJsonValues;
+	for (const TPair<FName, FCachedRuleSet>& RuleSetPair : RuleSets)
+	{
+		TArray<TSharedPtr<FJsonValue>> PackageJsonValues;
+		for (const TPair<FName, FCachedPackage>& PackagePair : RuleSetPair.Value.Packages)
+		{
+			TArray<TSharedPtr<FJsonValue>> ViolationJsonValues;
+			for (const FCachedViolation& CachedViolation : PackagePair.Value.Violations)
+			{
+				TSharedPtr<FJsonObject> ViolationJsonObject = MakeShareable(new FJsonObject);
+				ViolationJsonObject->SetStringField(TEXT("Object"), CachedViolation.ObjectPath.ToString());
+				ViolationJsonObject->SetStringField(TEXT("Rule"), CachedViolation.RuleClass.ToString());
+				ViolationJsonObject->SetStringField(TEXT("Action"), CachedViolation.RecommendedAction);
+				if (!CachedViolation.SuggestedName.IsEmpty())
+				{
+					ViolationJsonObject->SetStringField(TEXT("SuggestedName"), CachedViolation.SuggestedName);
+				}
+				ViolationJsonValues.Add(MakeShareable(new FJsonValueObject(ViolationJsonObject)));
+			}
+
+			TSharedPtr<FJsonObject> PackageJsonObject = MakeShareable(new FJsonObject);
+			PackageJsonObject->SetStringField(TEXT("Package"), PackagePair.Key.ToString());
+			PackageJsonObject->SetStringField(TEXT("Guid"), PackagePair.Value.PackageGuid.ToString());
+			PackageJsonObject->SetNumberField(TEXT("Errors"), PackagePair.Value.NumErrors);
+			PackageJsonObject->SetNumberField(TEXT("Warnings"), PackagePair.Value.NumWarnings);
+			PackageJsonObject->SetArrayField(TEXT("Violations"), ViolationJsonValues);
+			PackageJsonValues.Add(MakeShareable(new FJsonValueObject(PackageJsonObject)));
+		}
+
+		TSharedPtr<FJsonObject> RuleSetJsonObject = MakeShareable(new FJsonObject);
+		TArray<TSharedPtr<FJsonValue>> DependencyJsonValues;
+		for (const TPair<FName, FGuid>& DependencyGuid : RuleSetPair.Value.DependencyGuids)
+		{
+			TSharedPtr<FJsonObject> DependencyJsonObject = MakeShareable(new FJsonObject);
+			DependencyJsonObject->SetStringField(TEXT("Package"), DependencyGuid.Key.ToString());
+			DependencyJsonObject->SetStringField(TEXT("Guid"), DependencyGuid.Value.ToString());
+			DependencyJsonValues.Add(MakeShareable(new FJsonValueObject(DependencyJsonObject)));
+		}
+
+		RuleSetJsonObject->SetStringField(TEXT("RuleSet"), RuleSetPair.Key.ToString());
+		RuleSetJsonObject->SetArrayField(TEXT("Dependencies"), DependencyJsonValues);
+		RuleSetJsonObject->SetArrayField(TEXT("Packages"), PackageJsonValues);
+		RuleSetJsonValues.Add(MakeShareable(new FJsonValueObject(RuleSetJsonObject)));
+	}
+
+	TSharedPtr<FJsonObject> RootJsonObject = MakeShareable(new FJsonObject);
+	RootJsonObject->SetNumberField(TEXT("Version"), LintResultCacheVersion);
+	RootJsonObject->SetNumberField(TEXT("LinterVersion"), GetLinterVersion());
+	RootJsonObject->SetArrayField(TEXT("RuleSets"), RuleSetJsonValues);
+
+	FString CacheString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&CacheString);
+	FJsonSerializer::Serialize(RootJsonObject.ToSharedRef(), Writer);
+
+	if (FFileHelper::SaveStringToFile(CacheString, *GetCacheFilename()))
+	{
+		bDirty = false;
+	}
+	else
+	{
+		UE_LOG(LogLinter, Warning, TEXT("Failed to save lint result cache to \"%s\"."), *GetCacheFilename());
+	}
+}
+
+const FLintResultCache::FCachedRuleSet* FLintResultCache::FindRuleSet(const ULintRuleSet* RuleSet) const
+{
+	if (RuleSet == nullptr)
+	{
+		return nullptr;
+	}
+
+	return FindRuleSet(FName(*RuleSet->GetPathName()));
+}
+
+const FLintResultCache::FCachedRuleSet* FLintResultCache::FindRuleSet(FName RuleSetPath) const
+{
+	const FCachedRuleSet* CachedRuleSet = RuleSets.Find(RuleSetPath);
+	if (CachedRuleSet == nullptr || !AreDependenciesUpToDate(*CachedRuleSet))
+	{
+		return nullptr;
+	}
+
+	return CachedRuleSet;
+}
+
+int32 FLintResultCache::FindOrAddFolder(FCachedRuleSet& CachedRuleSet, const FString& FolderPath)
+{
+	const FName FolderName(*FolderPath);
+	if (const int32* ExistingIndex = CachedRuleSet.FolderIndices.Find(FolderName))
+	{
+		return *ExistingIndex;
+	}
+
+	// Link to the parent folder first, adding it if this is the first package under it. Mount points like /Game are roots.
+	int32 ParentIndex = INDEX_NONE;
+	int32 SlashIndex = INDEX_NONE;
+	if (FolderPath.FindLastChar(TEXT('/'), SlashIndex) && SlashIndex > 0)
+	{
+		ParentIndex = FindOrAddFolder(CachedRuleSet, FolderPath.Left(SlashIndex));
+	}
+
+	const int32 NewIndex = CachedRuleSet.Folders.AddDefaulted();
+	CachedRuleSet.Folders[NewIndex].ParentIndex = ParentIndex;
+	CachedRuleSet.FolderIndices.Add(FolderName, NewIndex);
+	return NewIndex;
+}
+
+void FLintResultCache::RollUpPackage(FCachedRuleSet& CachedRuleSet, FName PackageName, int32 DeltaErrors, int32 DeltaWarnings)
+{
+	if (DeltaErrors == 0 && DeltaWarnings == 0)
+	{
+		return;
+	}
+
+	for (int32 FolderIndex = FindOrAddFolder(CachedRuleSet, FPackageName::GetLongPackagePath(PackageName.ToString())); FolderIndex != INDEX_NONE; FolderIndex = CachedRuleSet.Folders[FolderIndex].ParentIndex)
+	{
+		CachedRuleSet.Folders[FolderIndex].NumErrors += DeltaErrors;
+		CachedRuleSet.Folders[FolderIndex].NumWarnings += DeltaWarnings;
+	}
+}
+
+FGuid FLintResultCache::GetPackageGuid(FName PackageName)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	const FAssetPackageData* PackageData = AssetRegistry.GetAssetPackageData(PackageName);
+	return PackageData != nullptr ? PackageData->PackageGuid : FGuid();
+}
+
+TMap<FName, FGuid> FLintResultCache::GetDependencyGuids(const ULintRuleSet* RuleSet)
+{
+	TMap<FName, FGuid> DependencyGuids;
+	for (const FName PackageName : RuleSet->GetDependencyPackageNames())
+	{
+		DependencyGuids.Add(PackageName, GetPackageGuid(PackageName));
+	}
+	return DependencyGuids;
+}
+
+bool FLintResultCache::AreDependenciesUpToDate(const FCachedRuleSet& CachedRuleSet)
+{
+	// A rule set always depends on its own package, so an empty list means nothing was ever stored
+	if (CachedRuleSet.DependencyGuids.Num() == 0)
+	{
+		return false;
+	}
+
+	for (const TPair<FName, FGuid>& DependencyGuid : CachedRuleSet.DependencyGuids)
+	{
+		if (DependencyGuid.Value != GetPackageGuid(DependencyGuid.Key))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+FString FLintResultCache::GetCacheFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Linter") / TEXT("LintResultCache.json");
+}
+
+void FLintResultCache::Load()
+{
+	FString CacheString;
+	if (!FFileHelper::LoadFileToString(CacheString, *GetCacheFilename()))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> RootJsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(CacheString);
+	if (!FJsonSerializer::Deserialize(Reader, RootJsonObject) || !RootJsonObject.IsValid())
+	{
+		UE_LOG(LogLinter, Warning, TEXT("Ignoring unreadable lint result cache \"%s\"."), *GetCacheFilename());
+		return;
+	}
+
+	int32 Version = 0;
+	int32 LinterVersion = 0;
+	if (!RootJsonObject->TryGetNumberField(TEXT("Version"), Version) || Version != LintResultCacheVersion
+		|| !RootJsonObject->TryGetNumberField(TEXT("LinterVersion"), LinterVersion) || LinterVersion != GetLinterVersion())
+	{
+		UE_LOG(LogLinter, Display, TEXT("Ignoring lint result cache \"%s\" saved by a different version of Linter."), *GetCacheFilename());
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& RuleSetJsonValue : RootJsonObject->GetArrayField(TEXT("RuleSets")))
+	{
+		const TSharedPtr<FJsonObject>& RuleSetJsonObject = RuleSetJsonValue->AsObject();
+		const FString RuleSetPath = RuleSetJsonObject->GetStringField(TEXT("RuleSet"));
+		FCachedRuleSet& CachedRuleSet = RuleSets.FindOrAdd(FName(*RuleSetPath));
+		for (const TSharedPtr<FJsonValue>& DependencyJsonValue : RuleSetJsonObject->GetArrayField(TEXT("Dependencies")))
+		{
+			const TSharedPtr<FJsonObject>& DependencyJsonObject = DependencyJsonValue->AsObject();
+			FGuid& DependencyGuid = CachedRuleSet.DependencyGuids.Add(FName(*DependencyJsonObject->GetStringField(TEXT("Package"))));
+			FGuid::Parse(DependencyJsonObject->GetStringField(TEXT("Guid")), DependencyGuid);
+		}
+
+		for (const TSharedPtr<FJsonValue>& PackageJsonValue : RuleSetJsonObject->GetArrayField(TEXT("Packages")))
+		{
+			const TSharedPtr<FJsonObject>& PackageJsonObject = PackageJsonValue->AsObject();
+			const FName PackageName(*PackageJsonObject->GetStringField(TEXT("Package")));
+			FCachedPackage& CachedPackage = CachedRuleSet.Packages.FindOrAdd(PackageName);
+			FGuid::Parse(PackageJsonObject->GetStringField(TEXT("Guid")), CachedPackage.PackageGuid);
+			CachedPackage.NumErrors = (int32)PackageJsonObject->GetNumberField(TEXT("Errors"));
+			CachedPackage.NumWarnings = (int32)PackageJsonObject->GetNumberField(TEXT("Warnings"));
+
+			for (const TSharedPtr<FJsonValue>& ViolationJsonValue : PackageJsonObject->GetArrayField(TEXT("Violations")))
+			{
+				const TSharedPtr<FJsonObject>& ViolationJsonObject = ViolationJsonValue->AsObject();
+				FCachedViolation& CachedViolation = CachedPackage.Violations.AddDefaulted_GetRef();
+				CachedViolation.ObjectPath = FName(*ViolationJsonObject->GetStringField(TEXT("Object")));
+				CachedViolation.RuleClass = FSoftClassPath(ViolationJsonObject->GetStringField(TEXT("Rule")));
+				CachedViolation.RecommendedAction = ViolationJsonObject->GetStringField(TEXT("Action"));
+				ViolationJsonObject->TryGetStringField(TEXT("SuggestedName"), CachedViolation.SuggestedName);
+			}
+
+			RollUpPackage(CachedRuleSet, PackageName, CachedPackage.NumErrors, CachedPackage.NumWarnings);
+		}
+	}
+}
@@ -12,6 +12,29 @@
 #include "AssetRegistryModule.h"
 
 
+static thread_local const FLintCancellationToken* CurrentCancellationToken = nullptr;
+
+bool FLintCancellationToken::IsCurrentRunCancelled()
+{
+	return CurrentCancellationToken != nullptr && CurrentCancellationToken->IsCancelled();
+}
+
+const FLintCancellationToken* FLintCancellationToken::GetCurrent()
+{
+	return CurrentCancellationToken;
+}
+
+FLintCancellationToken::FScope::FScope(const FLintCancellationToken* Token)
+	: PreviousToken(CurrentCancellationToken)
+{
+	CurrentCancellationToken = Token;
+}
+
+FLintCancellationToken::FScope::~FScope()
+{
+	CurrentCancellationToken = PreviousToken;
+}
+
 ULintRule::ULintRule(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -42,14 +65,58 @@ bool ULintRule::PassesRule(UObject* ObjectToLint, const ULintRuleSet* ParentRule
 		return true;
 	}
 
+	if (IsLintRunCancelled())
+	{
+		return true;
+	}
+
 	return PassesRule_Internal(ObjectToLint, ParentRuleSet, OutRuleViolations);
 }
 
+bool ULintRule::PassesRuleBatch(TArrayView<UObject* const> ObjectsToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const
+{
+	bool bFailedAnyObject = false;
+	for (UObject* ObjectToLint : ObjectsToLint)
+	{
+		TArray<FLintRuleViolation> RuleViolations;
+		bFailedAnyObject = !PassesRule(ObjectToLint, ParentRuleSet, RuleViolations) || bFailedAnyObject;
+		OutRuleViolations.Append(RuleViolations);
+	}
+
+	return !bFailedAnyObject;
+}
+
+bool ULintRule::RequiresGameThread() const
+{
+	if (bRequiresGameThread)
+	{
+		return true;
+	}
+
+	// Native classes find ULintRule's own native events, while Blueprint overrides are script functions without FUNC_Native
+	static const FName ScriptOverridableEventNames[] = { GET_FUNCTION_NAME_CHECKED(ULintRule, PassesRule_Internal), GET_FUNCTION_NAME_CHECKED(ULintRule, GetRuleBasedObjectVariantName) };
+	for (const FName EventName : ScriptOverridableEventNames)
+	{
+		const UFunction* Event = GetClass()->FindFunctionByName(EventName);
+		if (Event != nullptr && !Event->HasAnyFunctionFlags(FUNC_Native))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool ULintRule::IsRuleSuppressed() const
 {
 	return false;
 }
 
+bool ULintRule::IsLintRunCancelled()
+{
+	return FLintCancellationToken::IsCurrentRunCancelled();
+}
+
 FName ULintRule::GetRuleBasedObjectVariantName_Implementation(UObject* ObjectToLint) const
 {
 	if (ObjectToLint == nullptr)
@@ -171,7 +238,7 @@ TArray<UObject*> FLintRuleViolation::AllRuleViolationViolators(const TArray<FLin
 	TArray<UObject*> Violators;
 	for (const FLintRuleViolation& RuleViolation : RuleViolationCollection)
 	{
-		Violators.Add(RuleViolation.Violator.Get());
+		Violators.AddUnique(RuleViolation.Violator.Get());
 	}
 	return Violators;
 }
@@ -1,9 +1,15 @@
 #include "LintRuleSet.h"
 #include "LintRunner.h"
+#include "LintCostHistory.h"
 
 #include "AssetRegistryModule.h"
+#include "IAssetRegistry.h"
+#include "Misc/PackageName.h"
 #include "Modules/ModuleManager.h"
 #include "HAL/RunnableThread.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformMisc.h"
+#include "Async/ParallelFor.h"
 
 ULintRuleSet::ULintRuleSet(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -16,23 +22,74 @@ ULinterNamingConvention* ULintRuleSet::GetNamingConvention() const
 	return NamingConvention.Get();
 }
 
-TArray<FLintRuleViolation> ULintRuleSet::LintPath(TArray<FString> AssetPaths, FScopedSlowTask* ParentScopedSlowTask /*= nullptr*/) const
+void ULintRuleSet::LoadNamingConvention() const
 {
+	check(IsInGameThread());
 	NamingConvention.LoadSynchronous();
+}
 
-	TArray<FLintRuleViolation> RuleViolations;
+FName ULintRuleSet::GetReportName() const
+{
+	return NameForCommandlet.IsEmpty() ? GetFName() : FName(*NameForCommandlet);
+}
 
+TArray<FName> ULintRuleSet::GetDependencyPackageNames() const
+{
+	TArray<FName> PackageNames;
+	PackageNames.Add(GetOutermost()->GetFName());
+
+	const FString NamingConventionPackageName = NamingConvention.ToSoftObjectPath().GetLongPackageName();
+	if (!NamingConventionPackageName.IsEmpty())
+	{
+		PackageNames.AddUnique(FName(*NamingConventionPackageName));
+	}
+
+	for (const TPair<TSubclassOf<UObject>, FLintRuleList>& ClassRuleList : ClassLintRulesMap)
+	{
+		for (const TSubclassOf<ULintRule>& RuleClass : ClassRuleList.Value.LintRules)
+		{
+			if (RuleClass != nullptr && !FPackageName::IsScriptPackage(RuleClass->GetOutermost()->GetName()))
+			{
+				PackageNames.AddUnique(RuleClass->GetOutermost()->GetFName());
+			}
+		}
+	}
+
+	return PackageNames;
+}
+
+void ULintRuleSet::TagRuleViolations(TArray<FLintRuleViolation>& RuleViolations, int32 StartIndex /*= 0*/) const
+{
+	const FName ReportName = GetReportName();
+	for (int32 ViolationIndex = StartIndex; ViolationIndex < RuleViolations.Num(); ++ViolationIndex)
+	{
+		if (RuleViolations[ViolationIndex].RuleSetName.IsNone())
+		{
+			RuleViolations[ViolationIndex].RuleSetName = ReportName;
+		}
+	}
+}
+
+TArray<FLintRuleViolation> ULintRuleSet::LintPath(TArray<FString> AssetPaths, FScopedSlowTask* ParentScopedSlowTask /*= nullptr*/, FLintCancellationToken* CancellationToken /*= nullptr*/) const
+{
+	return LintAssets(GatherAssetsInPaths(AssetPaths), ParentScopedSlowTask, CancellationToken);
+}
+
+TArray<FAssetData> ULintRuleSet::GatherAssetsInPaths(TArray<FString> AssetPaths, bool bSearchAllAssets /*= true*/)
+{
 	if (AssetPaths.Num() == 0)
 	{
 		AssetPaths.Push(TEXT("/Game"));
 	}
 
-	// Begin loading assets
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
 
-	UE_LOG(LogLinter, Display, TEXT("Loading the asset registry..."));
-	AssetRegistryModule.Get().SearchAllAssets(/*bSynchronousSearch =*/true);
-	UE_LOG(LogLinter, Display, TEXT("Finished loading the asset registry. Loading assets..."));
+	if (bSearchAllAssets)
+	{
+		UE_LOG(LogLinter, Display, TEXT("Loading the asset registry..."));
+		AssetRegistryModule.Get().SearchAllAssets(/*bSynchronousSearch =*/true);
+		UE_LOG(LogLinter, Display, TEXT("Finished loading the asset registry. Gathering assets..."));
+	}
 
 	TArray<FAssetData> AssetList;
 
@@ -47,8 +104,87 @@ TArray<FLintRuleViolation> ULintRuleSet::LintPath(TArray<FString> AssetPaths, FS
 
 	AssetRegistryModule.Get().GetAssets(ARFilter, AssetList);
 
+	return AssetList;
+}
+
+TArray<FLintRuleViolation> ULintRuleSet::LintAssets(const TArray<FAssetData>& AssetList, FScopedSlowTask* ParentScopedSlowTask /*= nullptr*/, FLintCancellationToken* CancellationToken /*= nullptr*/) const
+{
+	return LintAssets(TArray<const ULintRuleSet*>({ this }), AssetList, ParentScopedSlowTask, CancellationToken);
+}
+
+TArray<FLintRuleViolation> ULintRuleSet::LintAssets(const TArray<const ULintRuleSet*>& RuleSets, const TArray<FAssetData>& InAssetList, FScopedSlowTask* ParentScopedSlowTask /*= nullptr*/, FLintCancellationToken* CancellationToken /*= nullptr*/, ILintAssetsProgress* Progress /*= nullptr*/)
+{
+	for (const ULintRuleSet* RuleSet : RuleSets)
+	{
+		RuleSet->LoadNamingConvention();
+	}
+
+	TArray<FAssetData> AssetList = InAssetList;
+	const int32 NumSkippedAssets = RemoveAssetsWithoutLintRules(RuleSets, AssetList);
+	if (NumSkippedAssets > 0)
+	{
+		UE_LOG(LogLinter, Display, TEXT("Skipped loading %d assets that no lint rules apply to."), NumSkippedAssets);
+	}
+
+	// Start the assets that took longest last time first, so they don't hold up the end of the run while every other thread is idle
+	FLintCostHistory& CostHistory = FLintCostHistory::Get();
+	CostHistory.SortLongestFirst(AssetList);
+
+	// Callers that don't care about cancelling still get cancelled through the slow task's cancel button
+	FLintCancellationToken LocalCancellationToken;
+	if (CancellationToken == nullptr)
+	{
+		CancellationToken = &LocalCancellationToken;
+	}
+
+	// Each asset's violations are kept apart, so they can be handed to Progress as soon as that asset is done
+	TArray<TArray<FLintRuleViolation>> AssetRuleViolations;
+	AssetRuleViolations.SetNum(AssetList.Num());
+
 	TArray<FLintRunner*> LintRunners;
 	TArray<FRunnableThread*> Threads;
+	TArray<UObject*> LintedObjects;
+
+	// Assets with rules that lint in batches are only finished once the batched rules have run, after every asset was loaded
+	TArray<bool> HasBatchedRules;
+	TArray<bool> IsAssetChecked;
+	int32 FirstUncheckedAssetIndex = 0;
+
+	// Time spent on the game thread loading and running game thread rules for each asset in LintRunners, to which its runner's time is added
+	TArray<double> AssetSeconds;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Tells Progress about every started asset whose runner is done, so a crash can be pinned on the assets that were still in flight
+	auto ReportCheckedAssets = [&]()
+	{
+		if (Progress == nullptr || CancellationToken->IsCancelled())
+		{
+			return;
+		}
+
+		for (int32 AssetIndex = FirstUncheckedAssetIndex; AssetIndex < LintRunners.Num(); ++AssetIndex)
+		{
+			if (IsAssetChecked[AssetIndex] || (Threads[AssetIndex] != nullptr && !LintRunners[AssetIndex]->IsFinished()))
+			{
+				continue;
+			}
+
+			IsAssetChecked[AssetIndex] = true;
+			if (AssetIndex == FirstUncheckedAssetIndex)
+			{
+				while (FirstUncheckedAssetIndex < IsAssetChecked.Num() && IsAssetChecked[FirstUncheckedAssetIndex])
+				{
+					FirstUncheckedAssetIndex++;
+				}
+			}
+
+			Progress->OnAssetChecked(AssetList[AssetIndex]);
+			if (!HasBatchedRules[AssetIndex])
+			{
+				Progress->OnAssetFinished(AssetList[AssetIndex], AssetRuleViolations[AssetIndex]);
+			}
+		}
+	};
 
 	if (ParentScopedSlowTask != nullptr)
 	{
@@ -58,38 +194,159 @@ TArray<FLintRuleViolation> ULintRuleSet::LintPath(TArray<FString> AssetPaths, FS
 
 	for (FAssetData const& Asset : AssetList)
 	{
+		if (ParentScopedSlowTask != nullptr && ParentScopedSlowTask->ShouldCancel())
+		{
+			CancellationToken->Cancel();
+		}
+
+		if (CancellationToken->IsCancelled())
+		{
+			UE_LOG(LogLinter, Display, TEXT("Lint cancelled. Waiting for in-flight assets to finish..."));
+			break;
+		}
+
 		check(Asset.IsValid());
+		if (Progress != nullptr)
+		{
+			Progress->OnAssetStarted(Asset);
+		}
+
 		UE_LOG(LogLinter, Verbose, TEXT("Creating Lint Thread for asset \"%s\"."), *Asset.AssetName.ToString());
+		const double AssetStartTime = FPlatformTime::Seconds();
 		UObject* Object = Asset.GetAsset();
 		check(Object != nullptr);
 
-		FLintRunner* Runner = new FLintRunner(Object, this, &RuleViolations, ParentScopedSlowTask);
+		const int32 AssetIndex = LintedObjects.Add(Object);
+		TArray<FLintRuleViolation>* RuleViolations = &AssetRuleViolations[AssetIndex];
+		HasBatchedRules.Add(RuleSets.ContainsByPredicate([Object](const ULintRuleSet* RuleSet)
+		{
+			const FLintRuleList* RuleList = RuleSet->GetLintRuleListForClass(Object->GetClass());
+			return RuleList != nullptr && RuleList->GetRules(ELintRuleThreadFilter::AllRules).ContainsByPredicate([](const ULintRule* Rule) { return Rule->LintsInBatches(); });
+		}));
+		IsAssetChecked.Add(false);
+
+		// Rules that can run anywhere get a thread, which runs every rule set's rules one after another,
+		// while game thread rules, including every rule implemented in Blueprint, run here in the meantime
+		FLintRunner* Runner = new FLintRunner(Object, RuleSets, RuleViolations, ParentScopedSlowTask, CancellationToken, ELintRuleThreadFilter::AnyThreadRules);
 		check(Runner != nullptr);
+		Runner->ExcludeBatchedRules();
 
 		LintRunners.Add(Runner);
+		Threads.Add(Runner->HasRulesToRun() ? FRunnableThread::Create(Runner, *FString::Printf(TEXT("FLintRunner - %s"), *Asset.ObjectPath.ToString()), 0, TPri_Normal) : nullptr);
 
-		if (Runner->RequiresGamethread())
+		FLintRunner GameThreadRunner(Object, RuleSets, RuleViolations, ParentScopedSlowTask, CancellationToken, ELintRuleThreadFilter::GameThreadRules);
+		GameThreadRunner.ExcludeBatchedRules();
+		if (GameThreadRunner.HasRulesToRun())
 		{
-			Runner->Run();
-			// If we're given a scoped slow task, update its progress now...
-			if (ParentScopedSlowTask != nullptr)
-			{
-				ParentScopedSlowTask->EnterProgressFrame(1.0f);
-			}
+			GameThreadRunner.Run();
 		}
-		else
+		AssetSeconds.Add(FPlatformTime::Seconds() - AssetStartTime);
+
+		ReportCheckedAssets();
+
+		// If we're given a scoped slow task, update its progress now...
+		if (ParentScopedSlowTask != nullptr)
+		{
+			ParentScopedSlowTask->EnterProgressFrame(1.0f);
+		}
+	}
+
+	for (FRunnableThread* Thread : Threads)
+	{
+		if (Thread != nullptr)
 		{
-			Threads.Push(FRunnableThread::Create(Runner, *FString::Printf(TEXT("FLintRunner - %s"), *Asset.ObjectPath.ToString()), 0, TPri_Normal));
-			if (ParentScopedSlowTask != nullptr)
+			Thread->WaitForCompletion();
+		}
+	}
+	ReportCheckedAssets();
+
+	for (FRunnableThread* Thread : Threads)
+	{
+		delete Thread;
+	}
+
+	// Every asset is still loaded, so rules that lint in batches can now see each class's objects all at once.
+	// Their violations go to the asset whose package the violator is in, so each asset's results stay together.
+	TArray<FLintRuleViolation> UnownedRuleViolations;
+	if (!CancellationToken->IsCancelled())
+	{
+		TArray<FLintRuleViolation> BatchedRuleViolations;
+		for (const ULintRuleSet* RuleSet : RuleSets)
+		{
+			RuleSet->RunBatchedRules(LintedObjects, CancellationToken, BatchedRuleViolations);
+		}
+
+		TMap<const UPackage*, int32> AssetIndicesByPackage;
+		for (int32 AssetIndex = 0; AssetIndex < LintedObjects.Num(); ++AssetIndex)
+		{
+			AssetIndicesByPackage.Add(LintedObjects[AssetIndex]->GetOutermost(), AssetIndex);
+		}
+
+		for (FLintRuleViolation& Violation : BatchedRuleViolations)
+		{
+			const UObject* Violator = Violation.Violator.Get();
+			const int32* AssetIndex = Violator != nullptr ? AssetIndicesByPackage.Find(Violator->GetOutermost()) : nullptr;
+			(AssetIndex != nullptr ? AssetRuleViolations[*AssetIndex] : UnownedRuleViolations).Add(MoveTemp(Violation));
+		}
+
+		if (Progress != nullptr && !CancellationToken->IsCancelled())
+		{
+			for (int32 AssetIndex = 0; AssetIndex < LintedObjects.Num(); ++AssetIndex)
 			{
-				ParentScopedSlowTask->EnterProgressFrame(1.0f);
+				if (HasBatchedRules[AssetIndex])
+				{
+					Progress->OnAssetFinished(AssetList[AssetIndex], AssetRuleViolations[AssetIndex]);
+				}
 			}
 		}
 	}
 
-	for (FRunnableThread* Thread : Threads)
+	TArray<FLintRuleViolation> RuleViolations;
+	for (TArray<FLintRuleViolation>& Violations : AssetRuleViolations)
+	{
+		RuleViolations.Append(MoveTemp(Violations));
+	}
+	RuleViolations.Append(MoveTemp(UnownedRuleViolations));
+
+	const double WallSeconds = FPlatformTime::Seconds() - StartTime;
+	double TotalAssetSeconds = 0.0;
+	int32 SlowestAssetIndex = INDEX_NONE;
+	double SlowestAssetSeconds = -1.0;
+	for (int32 AssetIndex = 0; AssetIndex < LintRunners.Num(); ++AssetIndex)
 	{
-		Thread->WaitForCompletion();
+		AssetSeconds[AssetIndex] += LintRunners[AssetIndex]->GetRunSeconds();
+	}
+
+	for (int32 AssetIndex = 0; AssetIndex < AssetSeconds.Num(); ++AssetIndex)
+	{
+		const FName PackageName = AssetList[AssetIndex].PackageName;
+		if (!CancellationToken->IsCancelled())
+		{
+			CostHistory.RecordDuration(PackageName, FLintCostHistory::GetPackageBytes(PackageName), AssetSeconds[AssetIndex]);
+		}
+
+		TotalAssetSeconds += AssetSeconds[AssetIndex];
+		if (AssetSeconds[AssetIndex] > SlowestAssetSeconds)
+		{
+			SlowestAssetIndex = AssetIndex;
+			SlowestAssetSeconds = AssetSeconds[AssetIndex];
+		}
+	}
+
+	// With the slowest assets started first, the time spent per asset should be spread across as many cores as possible for as long as possible
+	if (AssetSeconds.Num() > 1 && WallSeconds > 0.0)
+	{
+		const int32 NumCores = FMath::Min(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), AssetSeconds.Num());
+		const double AverageParallelism = TotalAssetSeconds / WallSeconds;
+		UE_LOG(LogLinter, Display, TEXT("Linted %d assets in %.2fs with %.2fs of work, an average of %.1f assets at a time (%.0f%% of %d cores)."),
+			AssetSeconds.Num(), WallSeconds, TotalAssetSeconds, AverageParallelism, 100.0 * FMath::Min(AverageParallelism / NumCores, 1.0), NumCores);
+		UE_LOG(LogLinter, Display, TEXT("Slowest asset: %s took %.2fs and was started %d of %d."),
+			*AssetList[SlowestAssetIndex].ObjectPath.ToString(), SlowestAssetSeconds, SlowestAssetIndex + 1, AssetSeconds.Num());
+	}
+
+	for (FLintRunner* Runner : LintRunners)
+	{
+		delete Runner;
 	}
 
 	if (ParentScopedSlowTask != nullptr)
@@ -100,9 +357,85 @@ TArray<FLintRuleViolation> ULintRuleSet::LintPath(TArray<FString> AssetPaths, FS
 	return RuleViolations;
 }
 
-TArray<TSharedPtr<FLintRuleViolation>> ULintRuleSet::LintPathShared(TArray<FString> AssetPaths, FScopedSlowTask* ParentScopedSlowTask /*= nullptr*/) const
+void ULintRuleSet::RunBatchedRules(const TArray<UObject*>& LintedObjects, const FLintCancellationToken* CancellationToken, TArray<FLintRuleViolation>& OutRuleViolations) const
 {
-	TArray<FLintRuleViolation> RuleViolations = LintPath(AssetPaths, ParentScopedSlowTask);
+	struct FRuleBatch
+	{
+		const ULintRule* Rule = nullptr;
+		TArray<UObject*> Objects;
+		TArray<FLintRuleViolation> RuleViolations;
+	};
+
+	TMap<UClass*, TArray<const ULintRule*>> BatchedRulesByClass;
+	TMap<TPair<const ULintRule*, UClass*>, int32> BatchIndices;
+	TArray<FRuleBatch> Batches;
+	for (UObject* Object : LintedObjects)
+	{
+		UClass* Class = Object->GetClass();
+		TArray<const ULintRule*>* BatchedRules = BatchedRulesByClass.Find(Class);
+		if (BatchedRules == nullptr)
+		{
+			BatchedRules = &BatchedRulesByClass.Add(Class);
+			if (const FLintRuleList* RuleList = GetLintRuleListForClass(Class))
+			{
+				*BatchedRules = RuleList->GetRules(ELintRuleThreadFilter::AllRules).FilterByPredicate([](const ULintRule* Rule) { return Rule->LintsInBatches(); });
+			}
+		}
+
+		for (const ULintRule* Rule : *BatchedRules)
+		{
+			int32& BatchIndex = BatchIndices.FindOrAdd(MakeTuple(Rule, Class), INDEX_NONE);
+			if (BatchIndex == INDEX_NONE)
+			{
+				BatchIndex = Batches.AddDefaulted();
+				Batches[BatchIndex].Rule = Rule;
+			}
+			Batches[BatchIndex].Objects.Add(Object);
+		}
+	}
+
+	if (Batches.Num() == 0)
+	{
+		return;
+	}
+
+	auto RunBatch = [this, &Batches, CancellationToken](int32 BatchIndex)
+	{
+		FLintCancellationToken::FScope CancellationScope(CancellationToken);
+		FRuleBatch& Batch = Batches[BatchIndex];
+		Batch.Rule->PassesRuleBatch(Batch.Objects, this, Batch.RuleViolations);
+	};
+
+	TArray<int32> AnyThreadBatchIndices;
+	for (int32 BatchIndex = 0; BatchIndex < Batches.Num(); ++BatchIndex)
+	{
+		if (Batches[BatchIndex].Rule->RequiresGameThread())
+		{
+			RunBatch(BatchIndex);
+		}
+		else
+		{
+			AnyThreadBatchIndices.Add(BatchIndex);
+		}
+	}
+
+	ParallelFor(AnyThreadBatchIndices.Num(), [&RunBatch, &AnyThreadBatchIndices](int32 Index)
+	{
+		RunBatch(AnyThreadBatchIndices[Index]);
+	});
+
+	for (FRuleBatch& Batch : Batches)
+	{
+		TagRuleViolations(Batch.RuleViolations);
+		OutRuleViolations.Append(MoveTemp(Batch.RuleViolations));
+	}
+
+	UE_LOG(LogLinter, Display, TEXT("Ran %d batches of rules that lint in batches over %d assets."), Batches.Num(), LintedObjects.Num());
+}
+
+TArray<TSharedPtr<FLintRuleViolation>> ULintRuleSet::LintPathShared(TArray<FString> AssetPaths, FScopedSlowTask* ParentScopedSlowTask /*= nullptr*/, FLintCancellationToken* CancellationToken /*= nullptr*/) const
+{
+	TArray<FLintRuleViolation> RuleViolations = LintPath(AssetPaths, ParentScopedSlowTask, CancellationToken);
 
 	TArray<TSharedPtr<FLintRuleViolation>> SharedRuleViolations;
 	for (FLintRuleViolation Violation : RuleViolations)
@@ -140,7 +473,118 @@ const FLintRuleList* ULintRuleSet::GetLintRuleListForClass(TSoftClassPtr<UObject
 	return nullptr;
 }
 
+int32 ULintRuleSet::RemoveAssetsWithoutLintRules(TArray<FAssetData>& InOutAssetList, TArray<FAssetData>* OutSkippedAssets /*= nullptr*/) const
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	// Asset data only knows class names, so match rule lists by name rather than by loaded class
+	TMap<FName, const FLintRuleList*> RuleListsByClassName;
+	for (const TPair<TSubclassOf<UObject>, FLintRuleList>& ClassRuleList : ClassLintRulesMap)
+	{
+		if (ClassRuleList.Key != nullptr)
+		{
+			RuleListsByClassName.Add(ClassRuleList.Key->GetFName(), &ClassRuleList.Value);
+		}
+	}
+	const FLintRuleList* AnyObjectRuleList = ClassLintRulesMap.Find(UAnyObject_LinterDummyClass::StaticClass());
+
+	// Mirrors GetLintRuleListForClass: the most derived class with a rule list wins, falling back to the any object rule list
+	auto HasLintRulesForClass = [&AssetRegistry, &RuleListsByClassName, AnyObjectRuleList](FName AssetClass)
+	{
+		TArray<FName> ClassNames;
+		ClassNames.Add(AssetClass);
+		if (UClass* Class = FindObject<UClass>(ANY_PACKAGE, *AssetClass.ToString()))
+		{
+			for (UClass* SuperClass = Class->GetSuperClass(); SuperClass != nullptr; SuperClass = SuperClass->GetSuperClass())
+			{
+				ClassNames.Add(SuperClass->GetFName());
+			}
+		}
+		else if (!AssetRegistry.GetAncestorClassNames(AssetClass, ClassNames))
+		{
+			// Unknown class, so leave it to the runner to find out once it's loaded
+			return true;
+		}
+
+		for (const FName ClassName : ClassNames)
+		{
+			if (const FLintRuleList* const* RuleList = RuleListsByClassName.Find(ClassName))
+			{
+				return (*RuleList)->LintRules.Num() > 0;
+			}
+		}
+
+		return AnyObjectRuleList != nullptr && AnyObjectRuleList->LintRules.Num() > 0;
+	};
+
+	TMap<FName, bool> HasLintRulesByClassName;
+	const int32 NumAssets = InOutAssetList.Num();
+	InOutAssetList.RemoveAll([&HasLintRulesForClass, &HasLintRulesByClassName, OutSkippedAssets](const FAssetData& Asset)
+	{
+		const bool* bCachedHasLintRules = HasLintRulesByClassName.Find(Asset.AssetClass);
+		const bool bHasLintRules = bCachedHasLintRules != nullptr ? *bCachedHasLintRules : HasLintRulesByClassName.Add(Asset.AssetClass, HasLintRulesForClass(Asset.AssetClass));
+		if (!bHasLintRules && OutSkippedAssets != nullptr)
+		{
+			OutSkippedAssets->Add(Asset);
+		}
+		return !bHasLintRules;
+	});
+
+	return NumAssets - InOutAssetList.Num();
+}
+
+int32 ULintRuleSet::RemoveAssetsWithoutLintRules(const TArray<const ULintRuleSet*>& RuleSets, TArray<FAssetData>& InOutAssetList, TArray<FAssetData>* OutSkippedAssets /*= nullptr*/)
+{
+	if (RuleSets.Num() == 1)
+	{
+		return RuleSets[0]->RemoveAssetsWithoutLintRules(InOutAssetList, OutSkippedAssets);
+	}
+
+	// An asset is kept as long as any of the rule sets has rules for it
+	TSet<FName> KeptObjectPaths;
+	for (const ULintRuleSet* RuleSet : RuleSets)
+	{
+		TArray<FAssetData> RuleSetAssetList = InOutAssetList;
+		RuleSet->RemoveAssetsWithoutLintRules(RuleSetAssetList);
+		for (const FAssetData& Asset : RuleSetAssetList)
+		{
+			KeptObjectPaths.Add(Asset.ObjectPath);
+		}
+	}
+
+	const int32 NumAssets = InOutAssetList.Num();
+	InOutAssetList.RemoveAll([&KeptObjectPaths, OutSkippedAssets](const FAssetData& Asset)
+	{
+		const bool bHasLintRules = KeptObjectPaths.Contains(Asset.ObjectPath);
+		if (!bHasLintRules && OutSkippedAssets != nullptr)
+		{
+			OutSkippedAssets->Add(Asset);
+		}
+		return !bHasLintRules;
+	});
+
+	return NumAssets - InOutAssetList.Num();
+}
+
+static bool PassesThreadFilter(const ULintRule* LintRule, ELintRuleThreadFilter Filter)
+{
+	switch (Filter)
+	{
+	case ELintRuleThreadFilter::GameThreadRules:
+		return LintRule->RequiresGameThread();
+	case ELintRuleThreadFilter::AnyThreadRules:
+		return !LintRule->RequiresGameThread();
+	default:
+		return true;
+	}
+}
+
 bool FLintRuleList::RequiresGameThread() const
+{
+	return HasRules(ELintRuleThreadFilter::GameThreadRules);
+}
+
+bool FLintRuleList::HasRules(ELintRuleThreadFilter Filter) const
 {
 	for (TSubclassOf<ULintRule> LintRuleSubClass : LintRules)
 	{
@@ -148,7 +592,7 @@ bool FLintRuleList::RequiresGameThread() const
 		if (LintClass != nullptr)
 		{
 			const ULintRule* LintRule = GetDefault<ULintRule>(LintClass);
-			if (LintRule != nullptr && LintRule->bRequiresGameThread)
+			if (LintRule != nullptr && PassesThreadFilter(LintRule, Filter))
 			{
 				return true;
 			}
@@ -158,18 +602,42 @@ bool FLintRuleList::RequiresGameThread() const
 	return false;
 }
 
-bool FLintRuleList::PassesRules(UObject* ObjectToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const
+TArray<const ULintRule*> FLintRuleList::GetRules(ELintRuleThreadFilter Filter) const
+{
+	TArray<const ULintRule*> Rules;
+	for (TSubclassOf<ULintRule> LintRuleSubClass : LintRules)
+	{
+		UClass* LintClass = LintRuleSubClass.Get();
+		if (LintClass != nullptr)
+		{
+			const ULintRule* LintRule = GetDefault<ULintRule>(LintClass);
+			if (LintRule != nullptr && PassesThreadFilter(LintRule, Filter))
+			{
+				Rules.Add(LintRule);
+			}
+		}
+	}
+
+	return Rules;
+}
+
+bool FLintRuleList::PassesRules(UObject* ObjectToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations, ELintRuleThreadFilter Filter /*= ELintRuleThreadFilter::AllRules*/, bool bIncludeBatchedRules /*= true*/) const
 {
 	OutRuleViolations.Empty();
 
 	bool bFailedAnyRule = false;
 	for (TSubclassOf<ULintRule> LintRuleSubClass : LintRules)
 	{
+		if (FLintCancellationToken::IsCurrentRunCancelled())
+		{
+			break;
+		}
+
 		UClass* LintClass = LintRuleSubClass.Get();
 		if (LintClass != nullptr)
 		{
 			const ULintRule* LintRule = GetDefault<ULintRule>(LintClass);
-			if (LintRule != nullptr)
+			if (LintRule != nullptr && PassesThreadFilter(LintRule, Filter) && (bIncludeBatchedRules || !LintRule->LintsInBatches()))
 			{
 				TArray<FLintRuleViolation> ViolatedRules;
 				bFailedAnyRule = !LintRule->PassesRule(ObjectToLint, ParentRuleSet, ViolatedRules) || bFailedAnyRule;
@@ -178,5 +646,10 @@ bool FLintRuleList::PassesRules(UObject* ObjectToLint, const ULintRuleSet* Paren
 		}
 	}
 
+	if (ParentRuleSet != nullptr)
+	{
+		ParentRuleSet->TagRuleViolations(OutRuleViolations);
+	}
+
 	return !bFailedAnyRule;
 }
@@ -68,7 +68,8 @@ bool ULintRule_Blueprint_Funcs_MaxNodes::PassesRule_Internal_Implementation(UObj
 	FText FixTextTemplate = NSLOCTEXT("Linter", "BlueprintFuncsMaxNodes", "{Previous}{WhiteSpace}Please simply function {FuncName} as it has {Nodes} nodes when we want a max of {MaxNodes}.");
 	FText AllFixes;
 
-	for (auto FunctionGraph : Blueprint->FunctionGraphs)
+	// Counting is done per graph in parallel, messages are put together afterwards in graph order
+	const TArray<int32> NonTrivialNodeCounts = CheckGraphs<int32>(Blueprint->FunctionGraphs, [this](const UEdGraph* FunctionGraph)
 	{
 		if (FunctionGraph->GetFName() != UEdGraphSchema_K2::FN_UserConstructionScript)
 		{
@@ -77,15 +78,21 @@ bool ULintRule_Blueprint_Funcs_MaxNodes::PassesRule_Internal_Implementation(UObj
 			{
 				auto NodesCopy = FunctionGraph->Nodes;
 				NodesCopy.RemoveAll([this](UEdGraphNode* Val) { return IsNodeTrivial(Val); });
-
-				// If removing knots and comments still exceeds node limit, report error
-				if (NodesCopy.Num() > MaxExpectedNonTrivialNodes)
-				{
-					AllFixes = FText::FormatNamed(FixTextTemplate, TEXT("Previous"), AllFixes, TEXT("FuncName"), FText::FromString(FunctionGraph->GetName()), TEXT("Nodes"), FText::FromString(FString::FromInt(NodesCopy.Num())), TEXT("MaxNodes"), FText::FromString(FString::FromInt(MaxExpectedNonTrivialNodes)), TEXT("WhiteSpace"), bRuleViolated ? FText::FromString(TEXT("\r\n")) : FText::GetEmpty());
-					bRuleViolated = true;
-				}
+				return NodesCopy.Num();
 			}
 		}
+
+		return 0;
+	});
+
+	for (int32 GraphIndex = 0; GraphIndex < NonTrivialNodeCounts.Num(); ++GraphIndex)
+	{
+		// If removing knots and comments still exceeds node limit, report error
+		if (NonTrivialNodeCounts[GraphIndex] > MaxExpectedNonTrivialNodes)
+		{
+			AllFixes = FText::FormatNamed(FixTextTemplate, TEXT("Previous"), AllFixes, TEXT("FuncName"), FText::FromString(Blueprint->FunctionGraphs[GraphIndex]->GetName()), TEXT("Nodes"), FText::FromString(FString::FromInt(NonTrivialNodeCounts[GraphIndex])), TEXT("MaxNodes"), FText::FromString(FString::FromInt(MaxExpectedNonTrivialNodes)), TEXT("WhiteSpace"), bRuleViolated ? FText::FromString(TEXT("\r\n")) : FText::GetEmpty());
+			bRuleViolated = true;
+		}
 	}
 
 	if (bRuleViolated)
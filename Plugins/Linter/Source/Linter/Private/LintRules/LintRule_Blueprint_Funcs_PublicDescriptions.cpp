@@ -33,7 +33,7 @@ bool ULintRule_Blueprint_Funcs_PublicDescriptions::PassesRule_Internal_Implement
 	FText FixTextTemplate = NSLOCTEXT("Linter", "BlueprintFuncsPublicDescriptions", "{Previous}{WhiteSpace}Please give public function {FuncName} a description.");
 	FText AllFixes;
 
-	for (UEdGraph* FunctionGraph : Blueprint->FunctionGraphs)
+	const TArray<bool> GraphsMissingDescriptions = CheckGraphs<bool>(Blueprint->FunctionGraphs, [](const UEdGraph* FunctionGraph)
 	{
 		if (FunctionGraph->GetFName() != UEdGraphSchema_K2::FN_UserConstructionScript)
 		{
@@ -51,14 +51,21 @@ bool ULintRule_Blueprint_Funcs_PublicDescriptions::PassesRule_Internal_Implement
 			{
 				if (FUNC_AccessSpecifiers & FunctionEntryNode->GetFunctionFlags() & FUNC_Public)
 				{
-					if (FunctionEntryNode->MetaData.ToolTip.IsEmpty())
-					{
-						AllFixes = FText::FormatNamed(FixTextTemplate, TEXT("Previous"), AllFixes, TEXT("FuncName"), FText::FromString(FunctionGraph->GetName()), TEXT("WhiteSpace"), bRuleViolated ? FText::FromString(TEXT("\r\n")) : FText::GetEmpty());
-						bRuleViolated = true;
-					}
+					return FunctionEntryNode->MetaData.ToolTip.IsEmpty();
 				}
 			}
 		}
+
+		return false;
+	});
+
+	for (int32 GraphIndex = 0; GraphIndex < GraphsMissingDescriptions.Num(); ++GraphIndex)
+	{
+		if (GraphsMissingDescriptions[GraphIndex])
+		{
+			AllFixes = FText::FormatNamed(FixTextTemplate, TEXT("Previous"), AllFixes, TEXT("FuncName"), FText::FromString(Blueprint->FunctionGraphs[GraphIndex]->GetName()), TEXT("WhiteSpace"), bRuleViolated ? FText::FromString(TEXT("\r\n")) : FText::GetEmpty());
+			bRuleViolated = true;
+		}
 	}
 
 	if (bRuleViolated)
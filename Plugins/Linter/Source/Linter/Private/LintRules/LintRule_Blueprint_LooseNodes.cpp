@@ -25,7 +25,7 @@ bool ULintRule_Blueprint_LooseNodes::PassesRule_Internal_Implementation(UObject*
 	TArray<UEdGraph*> Graphs;
 	Blueprint->GetAllGraphs(Graphs);
 
-	for (UEdGraph* Graph : Graphs)
+	const TArray<bool> GraphsWithLooseNodes = CheckGraphs<bool>(Graphs, [](const UEdGraph* Graph)
 	{
 		for (UEdGraphNode* Node : Graph->Nodes)
 		{
@@ -55,10 +55,17 @@ bool ULintRule_Blueprint_LooseNodes::PassesRule_Internal_Implementation(UObject*
 
 			if (bNodeIsolated)
 			{
-				OutRuleViolations.Push(FLintRuleViolation(ObjectToLint, GetClass()));
-				return false;
+				return true;
 			}
 		}
+
+		return false;
+	});
+
+	if (!IsLintRunCancelled() && GraphsWithLooseNodes.Contains(true))
+	{
+		OutRuleViolations.Push(FLintRuleViolation(ObjectToLint, GetClass()));
+		return false;
 	}
 
 	return true;
@@ -15,6 +15,11 @@ bool ULintRule_Collection::PassesRule_Internal_Implementation(UObject* ObjectToL
 
 	for (TSubclassOf<ULintRule> LintRuleClass : SubRules)
 	{
+		if (IsLintRunCancelled())
+		{
+			break;
+		}
+
 		if (LintRuleClass.Get() != nullptr)
 		{
 			const ULintRule* LintRule = GetDefault<ULintRule>(LintRuleClass);
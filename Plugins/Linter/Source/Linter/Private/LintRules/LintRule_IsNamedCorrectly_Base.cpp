@@ -53,7 +53,8 @@ bool ULintRule_IsNamedCorrectly_Base::PassesRule_Internal_Implementation(UObject
 	{
 		FString SuggestedName = BuildSuggestedName(ObjectToLint->GetName(), NameSettingList[0].Prefix, NameSettingList[0].Suffix);
 		FText RecommendedAction = FText::FormatOrdered(NSLOCTEXT("Linter", "IsNamedCorrectly_RecommendedAction", "Recommended name: [{0}]."), FText::FromString(SuggestedName));
-		OutRuleViolations.Push(FLintRuleViolation(ObjectToLint, GetClass(), RecommendedAction));
+		FLintRuleViolation& Violation = OutRuleViolations.Emplace_GetRef(ObjectToLint, GetClass(), RecommendedAction);
+		Violation.SuggestedName = SuggestedName;
 		return false;
 	}
 
@@ -29,7 +29,7 @@ bool ULintRule_Texture_Size_NotTooBig::PassesRule_Internal_Implementation(UObjec
 	int32 TexSizeY = Texture->GetSizeY();
 
 	// Check to see if textures are too big
-	if (TexSizeX > MaxTextureSizeX || TexSizeY > MaxTextureSizeY)
+	if (IsTooBig(TexSizeX, TexSizeY))
 	{
 		FText RecommendedAction = NSLOCTEXT("Linter", "LintRule_Texture_Size_NotTooBig_TooBig", "Please shrink your textures dimensions so that they fit within {0}x{1} pixels.");
 		OutRuleViolations.Push(FLintRuleViolation(ObjectToLint, GetClass(), FText::FormatOrdered(RecommendedAction, MaxTextureSizeX, MaxTextureSizeY)));
@@ -37,4 +37,54 @@ bool ULintRule_Texture_Size_NotTooBig::PassesRule_Internal_Implementation(UObjec
 	}
 
 	return true;
-}
\ No newline at end of file
+}
+
+bool ULintRule_Texture_Size_NotTooBig::PassesRuleBatch(TArrayView<UObject* const> ObjectsToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const
+{
+	// Blueprint children may check more than the size, so they go through PassesRule like always
+	if (RequiresGameThread())
+	{
+		return Super::PassesRuleBatch(ObjectsToLint, ParentRuleSet, OutRuleViolations);
+	}
+
+	if (ParentRuleSet == nullptr || IsRuleSuppressed() || IsLintRunCancelled())
+	{
+		return true;
+	}
+
+	// Pull every size out first, so the check itself is a single loop over plain integers
+	TArray<UTexture2D*> Textures;
+	TArray<int32> TexSizesX;
+	TArray<int32> TexSizesY;
+	Textures.Reserve(ObjectsToLint.Num());
+	TexSizesX.Reserve(ObjectsToLint.Num());
+	TexSizesY.Reserve(ObjectsToLint.Num());
+	for (UObject* ObjectToLint : ObjectsToLint)
+	{
+		if (UTexture2D* Texture = Cast<UTexture2D>(ObjectToLint))
+		{
+			Textures.Add(Texture);
+			TexSizesX.Add(Texture->GetSizeX());
+			TexSizesY.Add(Texture->GetSizeY());
+		}
+	}
+
+	TArray<bool> TooBig;
+	TooBig.SetNumUninitialized(Textures.Num());
+	for (int32 TextureIndex = 0; TextureIndex < Textures.Num(); ++TextureIndex)
+	{
+		TooBig[TextureIndex] = IsTooBig(TexSizesX[TextureIndex], TexSizesY[TextureIndex]);
+	}
+
+	// Only textures that failed go through PassesRule_Internal, which reports them exactly like PassesRule would
+	bool bFailedAnyTexture = false;
+	for (int32 TextureIndex = 0; TextureIndex < Textures.Num(); ++TextureIndex)
+	{
+		if (TooBig[TextureIndex])
+		{
+			bFailedAnyTexture = !PassesRule_Internal(Textures[TextureIndex], ParentRuleSet, OutRuleViolations) || bFailedAnyTexture;
+		}
+	}
+
+	return !bFailedAnyTexture;
+}
@@ -20,7 +20,7 @@ bool ULintRule_Texture_Size_PowerOfTwo::PassesRule(UObject* ObjectToLint, const
 	}
 
 	// If we're to ignore this texture LOD group, abort
-	if (IgnoreTexturesInTheseGroups.Contains(Cast<UTexture2D>(ObjectToLint)->LODGroup))
+	if (IsIgnored(Cast<UTexture2D>(ObjectToLint)))
 	{
 		return true;
 	}
@@ -35,8 +35,8 @@ bool ULintRule_Texture_Size_PowerOfTwo::PassesRule_Internal_Implementation(UObje
 	int32 TexSizeX = Texture->GetSizeX();
 	int32 TexSizeY = Texture->GetSizeY();
 
-	bool bXFail = ((TexSizeX & (TexSizeX - 1)) != 0);
-	bool bYFail = ((TexSizeY & (TexSizeY - 1)) != 0);
+	bool bXFail = !IsPowerOfTwo(TexSizeX);
+	bool bYFail = !IsPowerOfTwo(TexSizeY);
 
 	UEnum* TextureGroupEnum = StaticEnum<TextureGroup>();
 	FString IgnoredLODGroupNames;
@@ -70,4 +70,60 @@ bool ULintRule_Texture_Size_PowerOfTwo::PassesRule_Internal_Implementation(UObje
 	}
 	
 	return true;
-}
\ No newline at end of file
+}
+
+bool ULintRule_Texture_Size_PowerOfTwo::IsIgnored(const UTexture2D* Texture) const
+{
+	return IgnoreTexturesInTheseGroups.Contains(Texture->LODGroup);
+}
+
+bool ULintRule_Texture_Size_PowerOfTwo::PassesRuleBatch(TArrayView<UObject* const> ObjectsToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const
+{
+	// Blueprint children may check more than the size, so they go through PassesRule like always
+	if (RequiresGameThread())
+	{
+		return Super::PassesRuleBatch(ObjectsToLint, ParentRuleSet, OutRuleViolations);
+	}
+
+	if (ParentRuleSet == nullptr || IsRuleSuppressed() || IsLintRunCancelled())
+	{
+		return true;
+	}
+
+	// Pull every size out first, so the check itself is a single loop over plain integers
+	TArray<UTexture2D*> Textures;
+	TArray<int32> TexSizesX;
+	TArray<int32> TexSizesY;
+	Textures.Reserve(ObjectsToLint.Num());
+	TexSizesX.Reserve(ObjectsToLint.Num());
+	TexSizesY.Reserve(ObjectsToLint.Num());
+	for (UObject* ObjectToLint : ObjectsToLint)
+	{
+		UTexture2D* Texture = Cast<UTexture2D>(ObjectToLint);
+		if (Texture != nullptr && !IsIgnored(Texture))
+		{
+			Textures.Add(Texture);
+			TexSizesX.Add(Texture->GetSizeX());
+			TexSizesY.Add(Texture->GetSizeY());
+		}
+	}
+
+	TArray<bool> NotPowerOfTwo;
+	NotPowerOfTwo.SetNumUninitialized(Textures.Num());
+	for (int32 TextureIndex = 0; TextureIndex < Textures.Num(); ++TextureIndex)
+	{
+		NotPowerOfTwo[TextureIndex] = !IsPowerOfTwo(TexSizesX[TextureIndex]) | !IsPowerOfTwo(TexSizesY[TextureIndex]);
+	}
+
+	// Only textures that failed go through PassesRule_Internal, which reports them exactly like PassesRule would
+	bool bFailedAnyTexture = false;
+	for (int32 TextureIndex = 0; TextureIndex < Textures.Num(); ++TextureIndex)
+	{
+		if (NotPowerOfTwo[TextureIndex])
+		{
+			bFailedAnyTexture = !PassesRule_Internal(Textures[TextureIndex], ParentRuleSet, OutRuleViolations) || bFailedAnyTexture;
+		}
+	}
+
+	return !bFailedAnyTexture;
+}
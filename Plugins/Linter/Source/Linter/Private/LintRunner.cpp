@@ -1,42 +1,65 @@
 // Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
 #include "LintRunner.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeExit.h"
 
 #define LOCTEXT_NAMESPACE "Linter"
 
 FCriticalSection FLintRunner::LintDataUpdateLock;
 
-FLintRunner::FLintRunner(UObject* InLoadedObject, const ULintRuleSet* LintRuleSet, TArray<FLintRuleViolation>* InpOutRuleViolations, FScopedSlowTask* InParentScopedSlowTask)
+FLintRunner::FLintRunner(UObject* InLoadedObject, const ULintRuleSet* LintRuleSet, TArray<FLintRuleViolation>* InpOutRuleViolations, FScopedSlowTask* InParentScopedSlowTask, const FLintCancellationToken* InRunCancellationToken /*= nullptr*/, ELintRuleThreadFilter InRuleFilter /*= ELintRuleThreadFilter::AllRules*/)
+	: FLintRunner(InLoadedObject, TArray<const ULintRuleSet*>({ LintRuleSet }), InpOutRuleViolations, InParentScopedSlowTask, InRunCancellationToken, InRuleFilter)
+{
+}
+
+FLintRunner::FLintRunner(UObject* InLoadedObject, const TArray<const ULintRuleSet*>& LintRuleSets, TArray<FLintRuleViolation>* InpOutRuleViolations, FScopedSlowTask* InParentScopedSlowTask, const FLintCancellationToken* InRunCancellationToken /*= nullptr*/, ELintRuleThreadFilter InRuleFilter /*= ELintRuleThreadFilter::AllRules*/)
 	: LoadedObject(InLoadedObject)
-	, RuleSet(LintRuleSet)
 	, pOutRuleViolations(InpOutRuleViolations)
-	, pLoadedRuleList(LintRuleSet != nullptr ? LintRuleSet->GetLintRuleListForClass(InLoadedObject->GetClass()) : nullptr)
+	, RuleFilter(InRuleFilter)
 	, ParentScopedSlowTask(InParentScopedSlowTask)
+	, CancellationToken(InRunCancellationToken)
 {
+	for (const ULintRuleSet* LintRuleSet : LintRuleSets)
+	{
+		const FLintRuleList* RuleList = LintRuleSet != nullptr && InLoadedObject != nullptr ? LintRuleSet->GetLintRuleListForClass(InLoadedObject->GetClass()) : nullptr;
+		if (RuleList != nullptr)
+		{
+			LoadedRuleLists.Emplace(LintRuleSet, RuleList);
+		}
+	}
 }
 
 bool FLintRunner::RequiresGamethread()
 {
-	if (pLoadedRuleList != nullptr)
+	if (RuleFilter == ELintRuleThreadFilter::AnyThreadRules)
 	{
-		return pLoadedRuleList->RequiresGameThread();
+		return false;
 	}
 
-	return false;
+	return LoadedRuleLists.ContainsByPredicate([](const TPair<const ULintRuleSet*, const FLintRuleList*>& RuleList) { return RuleList.Value->RequiresGameThread(); });
 }
 
-bool FLintRunner::Init()
+bool FLintRunner::HasRulesToRun() const
 {
-	if (LoadedObject == nullptr)
+	for (const TPair<const ULintRuleSet*, const FLintRuleList*>& RuleList : LoadedRuleLists)
 	{
-		return false;
+		if (bIncludeBatchedRules ? RuleList.Value->HasRules(RuleFilter) : RuleList.Value->GetRules(RuleFilter).ContainsByPredicate([](const ULintRule* Rule) { return !Rule->LintsInBatches(); }))
+		{
+			return true;
+		}
 	}
 
-	if (RuleSet == nullptr)
+	return false;
+}
+
+bool FLintRunner::Init()
+{
+	if (LoadedObject == nullptr)
 	{
 		return false;
 	}
 
-	if (pLoadedRuleList == nullptr)
+	if (LoadedRuleLists.Num() == 0)
 	{
 		return false;
 	}
@@ -51,16 +74,32 @@ bool FLintRunner::Init()
 
 uint32 FLintRunner::Run()
 {	
-	if (LoadedObject == nullptr || pLoadedRuleList == nullptr || RuleSet == nullptr || pOutRuleViolations == nullptr)
+	ON_SCOPE_EXIT { bFinished = true; };
+
+	if (LoadedObject == nullptr || LoadedRuleLists.Num() == 0 || pOutRuleViolations == nullptr)
 	{
 		return 2;
 	}
 
+	if (CancellationToken.IsCancelled())
+	{
+		return 1;
+	}
+
+	FLintCancellationToken::FScope CancellationScope(&CancellationToken);
+
 	FString const AssetPath = LoadedObject->GetPathName();
 	UE_LOG(LogLinter, Display, TEXT("Loaded '%s'..."), *AssetPath);
 
+	const double StartTime = FPlatformTime::Seconds();
 	TArray<FLintRuleViolation> RuleViolations;
-	pLoadedRuleList->PassesRules(LoadedObject, RuleSet, RuleViolations);
+	for (const TPair<const ULintRuleSet*, const FLintRuleList*>& RuleList : LoadedRuleLists)
+	{
+		TArray<FLintRuleViolation> RuleSetViolations;
+		RuleList.Value->PassesRules(LoadedObject, RuleList.Key, RuleSetViolations, RuleFilter, bIncludeBatchedRules);
+		RuleViolations.Append(MoveTemp(RuleSetViolations));
+	}
+	RunSeconds = FPlatformTime::Seconds() - StartTime;
 
 	if (RuleViolations.Num() > 0)
 	{
@@ -74,7 +113,7 @@ uint32 FLintRunner::Run()
 
 void FLintRunner::Stop()
 {
-	return; // this runner doesn't have anything on-going so there is nothing to stop
+	CancellationToken.Cancel();
 }
 
 void FLintRunner::Exit()
@@ -18,6 +18,10 @@
 #include "LinterSettings.h"
 #include "UI/LintWizard.h"
 #include "LintRuleSet.h"
+#include "LintOnSaveWatcher.h"
+#include "LintIdleSweeper.h"
+#include "LintResultCache.h"
+#include "LintCostHistory.h"
 
 #define LOCTEXT_NAMESPACE "FLinterModule"
 
@@ -25,18 +29,7 @@ static const FName LinterTabName = "LinterTab";
 
 void FLinterModule::StartupModule()
 {
-	// Load the asset registry module
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(FName("AssetRegistry"));
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	if (AssetRegistry.IsLoadingAssets())
-	{
-		AssetRegistry.OnFilesLoaded().AddRaw(this, &FLinterModule::OnInitialAssetRegistrySearchComplete);
-	}
-	else
-	{
-		OnInitialAssetRegistrySearchComplete();
-	}
+	// Rule sets aren't loaded here, most sessions never lint, so they're loaded by whatever first lints with them
 
 	// Integrate Linter actions into existing editor context menus
 	if (!IsRunningCommandlet())
@@ -54,7 +47,7 @@ void FLinterModule::StartupModule()
 		}
 
 		// Install UI Hooks
-		FLinterContentBrowserExtensions::InstallHooks(this, &ContentBrowserExtenderDelegateHandle, &AssetExtenderDelegateHandle);
+		FLinterContentBrowserExtensions::InstallHooks(this, &ContentBrowserExtenderDelegateHandle, &AssetExtenderDelegateHandle, &AssetViewExtraStateDelegateHandle);
 
 		//Register our UI
 		FGlobalTabmanager::Get()->RegisterNomadTabSpawner(
@@ -66,11 +59,22 @@ void FLinterModule::StartupModule()
 
 		FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 		PropertyModule.RegisterCustomClassLayout(ULinterNamingConvention::StaticClass()->GetFName(), FOnGetDetailCustomizationInstance::CreateStatic(&FLinterNamingConventionDetails::MakeInstance));
+
+		LintOnSaveWatcher = MakeShareable(new FLintOnSaveWatcher());
+		LintIdleSweeper = MakeShareable(new FLintIdleSweeper());
 	}
 }
 
 void FLinterModule::ShutdownModule()
 {
+	LintOnSaveWatcher.Reset();
+	LintIdleSweeper.Reset();
+	if (!IsRunningCommandlet())
+	{
+		FLintResultCache::Get().SaveIfDirty();
+		FLintCostHistory::Get().SaveIfDirty();
+	}
+
 	if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
 	{
 		SettingsModule->UnregisterSettings("Project", "Plugins", "Linter");
@@ -81,7 +85,7 @@ void FLinterModule::ShutdownModule()
 		FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 		PropertyModule.UnregisterCustomClassLayout(ULinterNamingConvention::StaticClass()->GetFName());
 
-		FLinterContentBrowserExtensions::RemoveHooks(this, &ContentBrowserExtenderDelegateHandle, &AssetExtenderDelegateHandle);
+		FLinterContentBrowserExtensions::RemoveHooks(this, &ContentBrowserExtenderDelegateHandle, &AssetExtenderDelegateHandle, &AssetViewExtraStateDelegateHandle);
 
 		if (FModuleManager::Get().IsModuleLoaded(TEXT("LevelEditor")))
 		{
@@ -111,11 +115,6 @@ TSharedRef<SDockTab> FLinterModule::SpawnTab(const FSpawnTabArgs& TabSpawnArgs,
 	return MajorTab;
 }
 
-void FLinterModule::OnInitialAssetRegistrySearchComplete()
-{
-	TryToLoadAllLintRuleSets();
-}
-
 void FLinterModule::TryToLoadAllLintRuleSets()
 {
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(FName("AssetRegistry"));
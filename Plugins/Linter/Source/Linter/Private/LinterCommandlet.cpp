@@ -10,10 +10,21 @@
 #include "Interfaces/IPluginManager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/Crc.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Guid.h"
+#include "Misc/PackageName.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/JsonReader.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "Linter.h"
 #include "LintRule.h"
+#include "LintAssetRegistrySnapshot.h"
+#include "BatchRenameTool/BatchRenamer.h"
+#include "LintCostHistory.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LinterCommandlet, All, All);
 
@@ -29,239 +40,1152 @@ static void PrintUsage()
 	UE_LOG(LinterCommandlet, Display, TEXT("Linter Usage: {Editor}.exe Project.uproject -run=Linter \"/Game/\""));
 	UE_LOG(LinterCommandlet, Display, TEXT(""));
 	UE_LOG(LinterCommandlet, Display, TEXT("This will run the Linter on the provided project and will scan the supplied directory, example being the project's full Content/Game tree. Can add multiple paths as additional arguments."));
+	UE_LOG(LinterCommandlet, Display, TEXT("Use -Shard=Index/Count to only lint a stable, disjoint slice of the found assets and -MergeReports=A.json,B.json to combine shard reports into one."));
+	UE_LOG(LinterCommandlet, Display, TEXT("Use -Processes=N to lint in N local child processes. Assets that crash a child are reported as errors instead of failing the run."));
+	UE_LOG(LinterCommandlet, Display, TEXT("Use -AssetRegistrySnapshot=File.bin to load the asset registry from a previous run and only rescan packages that changed, saving it again for the next run."));
+	UE_LOG(LinterCommandlet, Display, TEXT("Add -VerifyAssetRegistrySnapshot to scan the whole project instead, check that the snapshot matches the scan, and save it again."));
+	UE_LOG(LinterCommandlet, Display, TEXT("Use -RuleSet=Name to lint with the rule set whose Name For Commandlet matches, or -RuleSet=A,B to lint with several rule sets while loading each asset only once."));
+	UE_LOG(LinterCommandlet, Display, TEXT("Use -AutoFix to rename every asset with a naming violation to its recommended name after the report is written. Can not be combined with -Processes or -Shard."));
 }
 
-int32 ULinterCommandlet::Main(const FString& InParams)
+/** The lint paths plus the folders rule sets are found in, leaving out paths that another path already contains since scans are recursive. */
+static TArray<FString> GetScopedScanPaths(const TArray<FString>& LintPaths)
 {
-	FString Params = InParams;
-	// Parse command line.
-	TArray<FString> Paths;
-	TArray<FString> Switches;
-	TMap<FString, FString> ParamsMap;
-	UCommandlet::ParseCommandLine(*Params, Paths, Switches, ParamsMap);
+	TArray<FString> CandidatePaths = LintPaths;
+	CandidatePaths.Add(IPluginManager::Get().FindPlugin(TEXT("Linter"))->GetMountedAssetPath());
 
-	UE_LOG(LinterCommandlet, Display, TEXT("Linter is indeed running!"));
-	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+	const FSoftObjectPath DefaultRuleSetPath = GetDefault<ULinterSettings>()->DefaultLintRuleSet.ToSoftObjectPath();
+	if (DefaultRuleSetPath.IsValid())
+	{
+		CandidatePaths.Add(FPackageName::GetLongPackagePath(DefaultRuleSetPath.GetLongPackageName()));
+	}
 
-	UE_LOG(LinterCommandlet, Display, TEXT("Loading the asset registry..."));
-	AssetRegistryModule.Get().SearchAllAssets(/*bSynchronousSearch =*/true);
-	UE_LOG(LinterCommandlet, Display, TEXT("Finished loading the asset registry. Determining Rule Set..."));
+	for (FString& CandidatePath : CandidatePaths)
+	{
+		CandidatePath.RemoveFromEnd(TEXT("/"));
+	}
 
-	ULintRuleSet* RuleSet = GetDefault<ULinterSettings>()->DefaultLintRuleSet.LoadSynchronous();
-	if (ParamsMap.Contains(TEXT("RuleSet")))
+	// Shorter paths first, so parents are kept before any of their children are considered
+	CandidatePaths.Sort([](const FString& A, const FString& B) { return A.Len() < B.Len(); });
+
+	TArray<FString> ScanPaths;
+	for (const FString& CandidatePath : CandidatePaths)
 	{
-		const FString RuleSetName = *ParamsMap.FindChecked(TEXT("RuleSet"));
-		UE_LOG(LinterCommandlet, Display, TEXT("Trying to find Rule Set with Commandlet Name: %s"), *RuleSetName);
+		const bool bAlreadyScanned = ScanPaths.ContainsByPredicate([&CandidatePath](const FString& ScanPath)
+		{
+			return CandidatePath.Equals(ScanPath, ESearchCase::IgnoreCase) || CandidatePath.StartsWith(ScanPath + TEXT("/"), ESearchCase::IgnoreCase);
+		});
+
+		if (!bAlreadyScanned)
+		{
+			ScanPaths.Add(CandidatePath);
+		}
+	}
 
-		FLinterModule::TryToLoadAllLintRuleSets();
+	return ScanPaths;
+}
+
+/**
+ * Makes sure the asset registry knows about every asset in LintPaths and the rule sets that may be used to lint them.
+ * If a snapshot was given, the whole project is loaded from it or scanned to create it, or with -VerifyAssetRegistrySnapshot,
+ * scanned and compared against it. Otherwise only LintPaths and the folders rule sets are found in are scanned,
+ * or the whole project if LintPaths is empty. bOutScannedAllAssets is set if the whole project ended up in the asset registry.
+ * Returns false if the snapshot didn't match the scan, in which case it is left as it was.
+ */
+static bool LoadAssetRegistry(const TArray<FString>& Switches, const TMap<FString, FString>& ParamsMap, const TArray<FString>& LintPaths, bool bSaveSnapshot, bool& bOutScannedAllAssets)
+{
+	bOutScannedAllAssets = true;
 
-		TArray<FAssetData> FoundRuleSets;
-		AssetRegistryModule.Get().GetAssetsByClass(ULintRuleSet::StaticClass()->GetFName(), FoundRuleSets, true);
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	const FString* SnapshotFilename = ParamsMap.Find(TEXT("AssetRegistrySnapshot"));
 
-		for (const FAssetData& RuleSetData : FoundRuleSets)
+	UE_LOG(LinterCommandlet, Display, TEXT("Loading the asset registry..."));
+	if (SnapshotFilename != nullptr)
+	{
+		int32 NumRescannedPackages = 0;
+		if (Switches.Contains(TEXT("VerifyAssetRegistrySnapshot")))
 		{
-			ULintRuleSet* LoadedRuleSet = Cast<ULintRuleSet>(RuleSetData.GetAsset());
-			if (LoadedRuleSet != nullptr && LoadedRuleSet->NameForCommandlet == RuleSetName)
+			AssetRegistry.SearchAllAssets(/*bSynchronousSearch =*/true);
+			if (!FLintAssetRegistrySnapshot::Verify(*SnapshotFilename))
 			{
-				RuleSet = LoadedRuleSet;
-				UE_LOG(LinterCommandlet, Display, TEXT("Found Rule Set for name %s: %s"), *RuleSetName, *RuleSet->GetFullName());
+				return false;
 			}
+			NumRescannedPackages = INDEX_NONE;
+		}
+		else if (FLintAssetRegistrySnapshot::Load(*SnapshotFilename, NumRescannedPackages))
+		{
+			UE_LOG(LinterCommandlet, Display, TEXT("Loaded the asset registry from snapshot \"%s\"."), **SnapshotFilename);
 		}
+		else
+		{
+			AssetRegistry.SearchAllAssets(/*bSynchronousSearch =*/true);
+			NumRescannedPackages = INDEX_NONE;
+		}
+
+		// Only refresh the snapshot if it changed, and never from child processes, which would all race to write the same file
+		if (bSaveSnapshot && NumRescannedPackages != 0)
+		{
+			FLintAssetRegistrySnapshot::Save(*SnapshotFilename);
+		}
+
+		return true;
 	}
-	else
+
+	if (LintPaths.Num() == 0)
 	{
-		UE_LOG(LinterCommandlet, Display, TEXT("Using default rule set..."));
+		AssetRegistry.SearchAllAssets(/*bSynchronousSearch =*/true);
+		return true;
 	}
 
-	if (RuleSet == nullptr)
+	// All paths go to a single scan, which gathers them together instead of walking each root in turn
+	const TArray<FString> ScanPaths = GetScopedScanPaths(LintPaths);
+	UE_LOG(LinterCommandlet, Display, TEXT("Scanning only: %s"), *FString::Join(ScanPaths, TEXT(", ")));
+	AssetRegistry.ScanPathsSynchronous(ScanPaths);
+	bOutScannedAllAssets = false;
+	return true;
+}
+
+/**
+ * Finds the rule set whose NameForCommandlet matches RuleSetName among the rule sets the asset registry knows about.
+ * Matches on the asset registry tag, so only the matching rule set is loaded. Rule sets saved before the tag existed are loaded to check.
+ */
+static ULintRuleSet* FindRuleSetForCommandlet(const FString& RuleSetName)
+{
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+	TArray<FAssetData> FoundRuleSets;
+	AssetRegistryModule.Get().GetAssetsByClass(ULintRuleSet::StaticClass()->GetFName(), FoundRuleSets, true);
+
+	ULintRuleSet* FoundRuleSet = nullptr;
+	for (const FAssetData& RuleSetData : FoundRuleSets)
 	{
-		UE_LOG(LinterCommandlet, Error, TEXT("Failed to load a rule set. Aborting. Returning error code 1."));
-		return 1;
+		FString TaggedName;
+		const bool bHasTag = RuleSetData.GetTagValue(GET_MEMBER_NAME_CHECKED(ULintRuleSet, NameForCommandlet), TaggedName);
+		if (bHasTag && TaggedName != RuleSetName)
+		{
+			continue;
+		}
+
+		if (!bHasTag)
+		{
+			UE_LOG(LinterCommandlet, Verbose, TEXT("Loading %s to check its name, resave it to avoid this."), *RuleSetData.ObjectPath.ToString());
+		}
+
+		ULintRuleSet* LoadedRuleSet = Cast<ULintRuleSet>(RuleSetData.GetAsset());
+		if (LoadedRuleSet != nullptr && LoadedRuleSet->NameForCommandlet == RuleSetName)
+		{
+			FoundRuleSet = LoadedRuleSet;
+			UE_LOG(LinterCommandlet, Display, TEXT("Found Rule Set for name %s: %s"), *RuleSetName, *FoundRuleSet->GetFullName());
+		}
 	}
 
-	UE_LOG(LinterCommandlet, Display, TEXT("Using rule set: %s"), *RuleSet->GetFullName());
+	return FoundRuleSet;
+}
 
-	if (Paths.Num() == 0)
+/** Parses a -Shard=Index/Count value. Index is zero based. Returns false if the value is malformed. */
+static bool ParseShard(const FString& ShardValue, int32& OutShardIndex, int32& OutNumShards)
+{
+	FString IndexString;
+	FString CountString;
+	if (!ShardValue.Split(TEXT("/"), &IndexString, &CountString) || !IndexString.IsNumeric() || !CountString.IsNumeric())
 	{
-		Paths.Add(TEXT("/Game"));
+		return false;
 	}
 
-	UE_LOG(LinterCommandlet, Display, TEXT("Attempting to Lint paths: %s"), *FString::Join(Paths, TEXT(", ")));
+	OutShardIndex = FCString::Atoi(*IndexString);
+	OutNumShards = FCString::Atoi(*CountString);
+	return OutNumShards > 0 && OutShardIndex >= 0 && OutShardIndex < OutNumShards;
+}
+
+/** Package names are hashed by their string contents so that every process, on every machine, agrees on which shard owns a package. */
+static bool IsPackageInShard(FName PackageName, int32 ShardIndex, int32 NumShards)
+{
+	const uint32 PackageHash = FCrc::StrCrc32(*PackageName.ToString().ToLower());
+	return (int32)(PackageHash % (uint32)NumShards) == ShardIndex;
+}
+
+static FString BuildResultsString(int32 NumWarnings, int32 NumErrors)
+{
+	return FText::FormatNamed(FText::FromString("Lint completed with {NumWarnings} {NumWarnings}|plural(one=warning,other=warnings), {NumErrors} {NumErrors}|plural(one=error,other=errors)."), TEXT("NumWarnings"), FText::FromString(FString::FromInt(NumWarnings)), TEXT("NumErrors"), FText::FromString(FString::FromInt(NumErrors))).ToString();
+}
+
+static TSharedPtr<FJsonObject> BuildJsonReport(const TArray<FLintRuleViolation>& RuleViolations)
+{
+	TSharedPtr<FJsonObject> RootJsonObject = MakeShareable(new FJsonObject);
+	TArray<TSharedPtr<FJsonValue>> ViolatorJsonObjects;
+
+	// Group every violation under its violator in a single pass, keeping violators in the order they were first found
+	TArray<UObject*> UniqueViolators;
+	TMap<UObject*, TArray<FLintRuleViolation>> ViolationsByViolator;
+	for (const FLintRuleViolation& Violation : RuleViolations)
+	{
+		UObject* Violator = Violation.Violator.Get();
+		TArray<FLintRuleViolation>* ViolatorViolations = ViolationsByViolator.Find(Violator);
+		if (ViolatorViolations == nullptr)
+		{
+			UniqueViolators.Add(Violator);
+			ViolatorViolations = &ViolationsByViolator.Add(Violator);
+		}
+		ViolatorViolations->Add(Violation);
+	}
+
+	for (UObject* Violator : UniqueViolators)
+	{
+		TSharedPtr<FJsonObject> AssetJsonObject = MakeShareable(new FJsonObject);
+		TArray<FLintRuleViolation>& UniqueViolatorViolations = ViolationsByViolator.FindChecked(Violator);
+
+		FAssetData AssetData;
+		if (UniqueViolatorViolations.Num() > 0)
+		{
+			UniqueViolatorViolations[0].PopulateAssetData();
+			AssetData = UniqueViolatorViolations[0].ViolatorAssetData;
+			AssetJsonObject->SetStringField(TEXT("ViolatorAssetName"), AssetData.AssetName.ToString());
+			AssetJsonObject->SetStringField(TEXT("ViolatorAssetPath"), AssetData.ObjectPath.ToString());
+			AssetJsonObject->SetStringField(TEXT("ViolatorFullName"), AssetData.GetFullName());
+			//@TODO: Thumbnail export?
+
+			TArray<TSharedPtr<FJsonValue>> RuleViolationJsonObjects;
+
+			for (const FLintRuleViolation& Violation : UniqueViolatorViolations)
+			{
+				ULintRule* LintRule = Violation.ViolatedRule->GetDefaultObject<ULintRule>();
+				check(LintRule != nullptr);
+
+				TSharedPtr<FJsonObject> RuleJsonObject = MakeShareable(new FJsonObject);
+				RuleJsonObject->SetStringField(TEXT("RuleGroup"), LintRule->RuleGroup.ToString());
+				RuleJsonObject->SetStringField(TEXT("RuleTitle"), LintRule->RuleTitle.ToString());
+				RuleJsonObject->SetStringField(TEXT("RuleDesc"), LintRule->RuleDescription.ToString());
+				RuleJsonObject->SetStringField(TEXT("RuleURL"), LintRule->RuleURL);
+				RuleJsonObject->SetNumberField(TEXT("RuleSeverity"), (int32)LintRule->RuleSeverity);
+				RuleJsonObject->SetStringField(TEXT("RuleRecommendedAction"), Violation.RecommendedAction.ToString());
+				if (!Violation.RuleSetName.IsNone())
+				{
+					RuleJsonObject->SetStringField(TEXT("RuleSet"), Violation.RuleSetName.ToString());
+				}
+				RuleViolationJsonObjects.Push(MakeShareable(new FJsonValueObject(RuleJsonObject)));
+			}
 
-	const TArray<FLintRuleViolation> RuleViolations = RuleSet->LintPath(Paths);
+			AssetJsonObject->SetArrayField(TEXT("Violations"), RuleViolationJsonObjects);
+		}
+
+		ViolatorJsonObjects.Add(MakeShareable(new FJsonValueObject(AssetJsonObject)));
+	}
 
+	RootJsonObject->SetArrayField(TEXT("Violators"), ViolatorJsonObjects);
+	return RootJsonObject;
+}
+
+/** Errors and warnings found by a single rule set. */
+struct FLintRuleSetCounts
+{
 	int32 NumErrors = 0;
 	int32 NumWarnings = 0;
+};
 
-	for (const FLintRuleViolation& Violation : RuleViolations)
+/**
+ * Counts errors and warnings the same way a live lint does, using each serialized violation's RuleSeverity.
+ * Violations tagged with the rule set that found them are also counted per rule set, keyed by its name.
+ */
+static void CountJsonReportViolations(const TSharedPtr<FJsonObject>& RootJsonObject, int32& OutNumErrors, int32& OutNumWarnings, TMap<FString, FLintRuleSetCounts>* OutRuleSetCounts = nullptr)
+{
+	const TArray<TSharedPtr<FJsonValue>>* ViolatorJsonValues = nullptr;
+	if (!RootJsonObject->TryGetArrayField(TEXT("Violators"), ViolatorJsonValues))
+	{
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& ViolatorJsonValue : *ViolatorJsonValues)
 	{
-		if (Violation.ViolatedRule->GetDefaultObject<ULintRule>()->RuleSeverity <= ELintRuleSeverity::Error)
+		const TArray<TSharedPtr<FJsonValue>>* ViolationJsonValues = nullptr;
+		if (!ViolatorJsonValue->AsObject()->TryGetArrayField(TEXT("Violations"), ViolationJsonValues))
+		{
+			continue;
+		}
+
+		for (const TSharedPtr<FJsonValue>& ViolationJsonValue : *ViolationJsonValues)
 		{
-			NumErrors++;
+			int32 RuleSeverity = (int32)ELintRuleSeverity::Error;
+			ViolationJsonValue->AsObject()->TryGetNumberField(TEXT("RuleSeverity"), RuleSeverity);
+
+			FString RuleSetName;
+			FLintRuleSetCounts* RuleSetCounts = OutRuleSetCounts != nullptr && ViolationJsonValue->AsObject()->TryGetStringField(TEXT("RuleSet"), RuleSetName) ? &OutRuleSetCounts->FindOrAdd(RuleSetName) : nullptr;
+			if (RuleSeverity <= (int32)ELintRuleSeverity::Error)
+			{
+				OutNumErrors++;
+				if (RuleSetCounts != nullptr)
+				{
+					RuleSetCounts->NumErrors++;
+				}
+			}
+			else
+			{
+				OutNumWarnings++;
+				if (RuleSetCounts != nullptr)
+				{
+					RuleSetCounts->NumWarnings++;
+				}
+			}
+		}
+	}
+}
+
+/** Resolves a report path given on the commandline. Relative paths are relative to the project's Saved/LintReports folder. */
+static FString ResolveReportPath(const FString& ReportPath)
+{
+	const FString LintReportPath = FPaths::ProjectSavedDir() / TEXT("LintReports");
+	return FPaths::ConvertRelativePathToFull(FPaths::IsRelative(ReportPath) ? LintReportPath / ReportPath : ReportPath);
+}
+
+/** Expands a -MergeReports value into a list of report files. Entries may be report files or folders containing reports. */
+static TArray<FString> ResolveReportFiles(const FString& MergeReportsValue)
+{
+	TArray<FString> ReportEntries;
+	MergeReportsValue.ParseIntoArray(ReportEntries, TEXT(","), true);
+
+	TArray<FString> ReportFiles;
+	for (const FString& ReportEntry : ReportEntries)
+	{
+		const FString FullEntryPath = ResolveReportPath(ReportEntry.TrimStartAndEnd());
+		if (IFileManager::Get().DirectoryExists(*FullEntryPath))
+		{
+			TArray<FString> FoundFiles;
+			IFileManager::Get().FindFiles(FoundFiles, *(FullEntryPath / TEXT("*.json")), true, false);
+			FoundFiles.Sort();
+			for (const FString& FoundFile : FoundFiles)
+			{
+				ReportFiles.Add(FullEntryPath / FoundFile);
+			}
 		}
 		else
 		{
-			NumWarnings++;
+			ReportFiles.Add(FullEntryPath);
+		}
+	}
+
+	return ReportFiles;
+}
+
+/** Loads every given report into a single report. Returns nullptr if any report fails to load. */
+static TSharedPtr<FJsonObject> MergeJsonReports(const TArray<FString>& ReportFiles)
+{
+	if (ReportFiles.Num() == 0)
+	{
+		UE_LOG(LinterCommandlet, Error, TEXT("No reports found to merge."));
+		return nullptr;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> MergedViolatorJsonObjects;
+	for (const FString& ReportFile : ReportFiles)
+	{
+		FString ReportString;
+		if (!FFileHelper::LoadFileToString(ReportString, *ReportFile))
+		{
+			UE_LOG(LinterCommandlet, Error, TEXT("Failed to load report to merge: %s"), *ReportFile);
+			return nullptr;
+		}
+
+		TSharedPtr<FJsonObject> ReportJsonObject;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ReportString);
+		const TArray<TSharedPtr<FJsonValue>>* ViolatorJsonValues = nullptr;
+		if (!FJsonSerializer::Deserialize(Reader, ReportJsonObject) || !ReportJsonObject.IsValid() || !ReportJsonObject->TryGetArrayField(TEXT("Violators"), ViolatorJsonValues))
+		{
+			UE_LOG(LinterCommandlet, Error, TEXT("Report is not a valid lint report: %s"), *ReportFile);
+			return nullptr;
 		}
+
+		UE_LOG(LinterCommandlet, Display, TEXT("Merging %d violators from %s"), ViolatorJsonValues->Num(), *ReportFile);
+		MergedViolatorJsonObjects.Append(*ViolatorJsonValues);
 	}
 
-	FString ResultsString = FText::FormatNamed(FText::FromString("Lint completed with {NumWarnings} {NumWarnings}|plural(one=warning,other=warnings), {NumErrors} {NumErrors}|plural(one=error,other=errors)."), TEXT("NumWarnings"), FText::FromString(FString::FromInt(NumWarnings)), TEXT("NumErrors"), FText::FromString(FString::FromInt(NumErrors))).ToString();
-	UE_LOG(LinterCommandlet, Display, TEXT("Lint completed with %s."), *ResultsString);
+	TSharedPtr<FJsonObject> RootJsonObject = MakeShareable(new FJsonObject);
+	RootJsonObject->SetArrayField(TEXT("Violators"), MergedViolatorJsonObjects);
+	return RootJsonObject;
+}
 
+/** Writes the -json and -html reports if requested. Returns false if any requested report could not be written. */
+static bool WriteReports(const TSharedPtr<FJsonObject>& RootJsonObject, const FString& ResultsString, const TArray<FString>& Switches, const TMap<FString, FString>& ParamsMap)
+{
 	bool bWriteReport = Switches.Contains(TEXT("json")) || ParamsMap.Contains(TEXT("json")) || Switches.Contains(TEXT("html")) || ParamsMap.Contains(TEXT("html"));
-	if (bWriteReport)
+	if (!bWriteReport)
+	{
+		return true;
+	}
+
+	UE_LOG(LinterCommandlet, Display, TEXT("Generating output report..."));
+
+	// Save off our JSON to a string
+	FString JsonReport;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonReport);
+	FJsonSerializer::Serialize(RootJsonObject.ToSharedRef(), Writer);
+
+	// write json file if requested
+	if (Switches.Contains(TEXT("json")) || ParamsMap.Contains(FString(TEXT("json"))))
 	{
-		UE_LOG(LinterCommandlet, Display, TEXT("Generating output report..."));
+		FString JsonOutputName = TEXT("lint-report-") + FDateTime::Now().ToString() + TEXT(".json");
+		if (ParamsMap.Contains(FString(TEXT("json"))))
+		{
+			JsonOutputName = ParamsMap.FindChecked(FString(TEXT("json")));
+		}
 
-		TSharedPtr<FJsonObject> RootJsonObject = MakeShareable(new FJsonObject);
-		TArray<TSharedPtr<FJsonValue>> ViolatorJsonObjects;
+		const FString FullOutputPath = ResolveReportPath(JsonOutputName);
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(FullOutputPath), true);
 
-		TArray<UObject*> UniqueViolators = FLintRuleViolation::AllRuleViolationViolators(RuleViolations);
-		for (const UObject* Violator : UniqueViolators)
+		UE_LOG(LinterCommandlet, Display, TEXT("Exporting JSON report to %s"), *FullOutputPath);
+		if (FFileHelper::SaveStringToFile(JsonReport, *FullOutputPath))
+		{
+			UE_LOG(LinterCommandlet, Display, TEXT("Exported JSON report successfully."));
+		}
+		else
 		{
-			TSharedPtr<FJsonObject> AssetJsonObject = MakeShareable(new FJsonObject);
-			TArray<FLintRuleViolation> UniqueViolatorViolations = FLintRuleViolation::AllRuleViolationsWithViolator(RuleViolations, Violator);
+			UE_LOG(LinterCommandlet, Error, TEXT("Failed to export JSON report."));
+			return false;
+		}
+	}
 
-			FAssetData AssetData;
-			if (UniqueViolatorViolations.Num() > 0)
-			{
-				UniqueViolatorViolations[0].PopulateAssetData();
-				AssetData = UniqueViolatorViolations[0].ViolatorAssetData;
-				AssetJsonObject->SetStringField(TEXT("ViolatorAssetName"), AssetData.AssetName.ToString());
-				AssetJsonObject->SetStringField(TEXT("ViolatorAssetPath"), AssetData.ObjectPath.ToString());
-				AssetJsonObject->SetStringField(TEXT("ViolatorFullName"), AssetData.GetFullName());
-				//@TODO: Thumbnail export?
+	// write HTML report if requested
+	if (Switches.Contains(TEXT("html")) || ParamsMap.Contains(FString(TEXT("html"))))
+	{
+		FString HtmlOutputName = TEXT("lint-report-") + FDateTime::Now().ToString() + TEXT(".html");
+		if (ParamsMap.Contains(FString(TEXT("html"))))
+		{
+			HtmlOutputName = ParamsMap.FindChecked(TEXT("html"));
+		}
 
-				TArray<TSharedPtr<FJsonValue>> RuleViolationJsonObjects;
+		const FString FullOutputPath = ResolveReportPath(HtmlOutputName);
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(FullOutputPath), true);
+		UE_LOG(LinterCommandlet, Display, TEXT("Exporting HTML report to %s"), *FullOutputPath);
 
-				for (const FLintRuleViolation& Violation : UniqueViolatorViolations)
-				{
-					ULintRule* LintRule = Violation.ViolatedRule->GetDefaultObject<ULintRule>();
-					check(LintRule != nullptr);
-
-					TSharedPtr<FJsonObject> RuleJsonObject = MakeShareable(new FJsonObject);
-					RuleJsonObject->SetStringField(TEXT("RuleGroup"), LintRule->RuleGroup.ToString());
-					RuleJsonObject->SetStringField(TEXT("RuleTitle"), LintRule->RuleTitle.ToString());
-					RuleJsonObject->SetStringField(TEXT("RuleDesc"), LintRule->RuleDescription.ToString());
-					RuleJsonObject->SetStringField(TEXT("RuleURL"), LintRule->RuleURL);
-					RuleJsonObject->SetNumberField(TEXT("RuleSeverity"), (int32)LintRule->RuleSeverity);
-					RuleJsonObject->SetStringField(TEXT("RuleRecommendedAction"), Violation.RecommendedAction.ToString());
-					RuleViolationJsonObjects.Push(MakeShareable(new FJsonValueObject(RuleJsonObject)));
-				}
+		FString TemplatePath = FPaths::Combine(*IPluginManager::Get().FindPlugin(TEXT("Linter"))->GetBaseDir(), TEXT("Resources"), TEXT("LintReportTemplate.html"));
+		UE_LOG(LinterCommandlet, Display, TEXT("Loading HTML report template from %s"), *TemplatePath);
 
-				AssetJsonObject->SetArrayField(TEXT("Violations"), RuleViolationJsonObjects);
-			}
+		FString HTMLReport;
+		if (FFileHelper::LoadFileToString(HTMLReport, *TemplatePath))
+		{
+			UE_LOG(LinterCommandlet, Display, TEXT("Loading HTML report template successfully."));
 
-			ViolatorJsonObjects.Add(MakeShareable(new FJsonValueObject(AssetJsonObject)));
+			HTMLReport.ReplaceInline(TEXT("{% TITLE %}"), *FPaths::GetBaseFilename(FPaths::GetProjectFilePath()));
+			HTMLReport.ReplaceInline(TEXT("{% RESULTS %}"), *ResultsString);
+			HTMLReport.ReplaceInline(TEXT("{% LINT_REPORT %}"), *JsonReport);
+		}
+		else
+		{
+			UE_LOG(LinterCommandlet, Error, TEXT("Failed to load HTML report template."));
+			return false;
+		}
 
+		if (FFileHelper::SaveStringToFile(HTMLReport, *FullOutputPath))
+		{
+			UE_LOG(LinterCommandlet, Display, TEXT("Exported HTML report successfully."));
 		}
+		else
+		{
+			UE_LOG(LinterCommandlet, Error, TEXT("Failed to export HTML report."));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/** The exit code for a lint that found NumErrors errors and NumWarnings warnings: 2 if it failed, 0 if it passed. */
+static int32 GetLintExitCode(int32 NumErrors, int32 NumWarnings, const TArray<FString>& Switches)
+{
+	return NumErrors > 0 || Switches.Contains(TEXT("TreatWarningsAsErrors")) && NumWarnings > 0 ? 2 : 0;
+}
+
+/**
+ * Counts, logs and writes a finished JSON report and returns the commandlet's exit code for it.
+ * When several rule sets were linted with, each one's counts and exit code are logged and added to the report under "RuleSets",
+ * and the returned exit code is the worst of them. RuleViolations are only needed to -AutoFix, which merged reports can't do.
+ */
+static int32 FinishJsonReport(const TSharedPtr<FJsonObject>& RootJsonObject, const TArray<FString>& Switches, const TMap<FString, FString>& ParamsMap, const TArray<FLintRuleViolation>* RuleViolations = nullptr)
+{
+	int32 NumErrors = 0;
+	int32 NumWarnings = 0;
+	TMap<FString, FLintRuleSetCounts> RuleSetCounts;
+	CountJsonReportViolations(RootJsonObject, NumErrors, NumWarnings, &RuleSetCounts);
 
-		// Save off our JSON to a string
-		RootJsonObject->SetArrayField(TEXT("Violators"), ViolatorJsonObjects);
-		FString JsonReport;
-		TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonReport);
-		FJsonSerializer::Serialize(RootJsonObject.ToSharedRef(), Writer);
+	const FString ResultsString = BuildResultsString(NumWarnings, NumErrors);
+	UE_LOG(LinterCommandlet, Display, TEXT("%s"), *ResultsString);
 
-		// write json file if requested
-		if (Switches.Contains(TEXT("json")) || ParamsMap.Contains(FString(TEXT("json"))))
+	// Every violation counts towards its own rule set and the total, so the worst rule set's exit code is also the total's
+	RuleSetCounts.KeySort(TLess<FString>());
+	TSharedPtr<FJsonObject> RuleSetsJsonObject = MakeShareable(new FJsonObject);
+	for (const TPair<FString, FLintRuleSetCounts>& RuleSetPair : RuleSetCounts)
+	{
+		const int32 RuleSetExitCode = GetLintExitCode(RuleSetPair.Value.NumErrors, RuleSetPair.Value.NumWarnings, Switches);
+		if (RuleSetCounts.Num() > 1)
 		{
-			FDateTime Now = FDateTime::Now();
-			FString JsonOutputName = TEXT("lint-report-") + FDateTime::Now().ToString() + TEXT(".json");
+			UE_LOG(LinterCommandlet, Display, TEXT("Rule set %s: %d errors, %d warnings. Exit code %d."), *RuleSetPair.Key, RuleSetPair.Value.NumErrors, RuleSetPair.Value.NumWarnings, RuleSetExitCode);
+		}
 
-			const FString LintReportPath = FPaths::ProjectSavedDir() / TEXT("LintReports");
-			FString FullOutputPath = LintReportPath / JsonOutputName;
+		TSharedPtr<FJsonObject> RuleSetJsonObject = MakeShareable(new FJsonObject);
+		RuleSetJsonObject->SetNumberField(TEXT("NumErrors"), RuleSetPair.Value.NumErrors);
+		RuleSetJsonObject->SetNumberField(TEXT("NumWarnings"), RuleSetPair.Value.NumWarnings);
+		RuleSetJsonObject->SetNumberField(TEXT("ExitCode"), RuleSetExitCode);
+		RuleSetsJsonObject->SetObjectField(RuleSetPair.Key, RuleSetJsonObject);
+	}
+	RootJsonObject->SetObjectField(TEXT("RuleSets"), RuleSetsJsonObject);
+
+	if (!WriteReports(RootJsonObject, ResultsString, Switches, ParamsMap))
+	{
+		UE_LOG(LinterCommandlet, Error, TEXT("Failed to export report. Aborting. Returning error code 1."));
+		return 1;
+	}
 
-			if (ParamsMap.Contains(FString(TEXT("json"))))
+	// The report and return code describe the project as it was linted, so fixes only show up in the next run
+	if (Switches.Contains(TEXT("AutoFix")) && RuleViolations != nullptr)
+	{
+		const TArray<FBatchRenameEntry> Entries = FBatchRenamer::PlanFromSuggestedNames(*RuleViolations);
+		for (const FBatchRenameEntry& Entry : Entries)
+		{
+			if (Entry.HasConflict())
 			{
-				const FString JsonOutputOverride = *ParamsMap.FindChecked(FString(TEXT("json")));
-				if (FPaths::IsRelative(JsonOutputOverride))
-				{
-					JsonOutputName = JsonOutputOverride;
-					FullOutputPath = LintReportPath / JsonOutputName;
-				}
-				else
-				{
-					FullOutputPath = JsonOutputOverride;
-				}
+				UE_LOG(LinterCommandlet, Warning, TEXT("Skipped renaming %s to %s: %s"), *Entry.AssetData.ObjectPath.ToString(), *Entry.NewName, *Entry.Conflict.ToString());
 			}
+		}
+
+		const int32 NumConflicts = Entries.FilterByPredicate([](const FBatchRenameEntry& Entry) { return Entry.HasConflict(); }).Num();
+		UE_LOG(LinterCommandlet, Display, TEXT("Auto fixing naming violations: renaming %d assets, skipping %d."), Entries.Num() - NumConflicts, NumConflicts);
+		if (!FBatchRenamer::Execute(Entries))
+		{
+			UE_LOG(LinterCommandlet, Error, TEXT("Failed to rename some assets. Aborting. Returning error code 1."));
+			return 1;
+		}
+	}
+
+	if (GetLintExitCode(NumErrors, NumWarnings, Switches) != 0)
+	{
+		UE_LOG(LinterCommandlet, Display, TEXT("Lint completed with errors. Returning error code 2."));
+		return 2;
+	}
+
+	return 0;
+}
+
+/** Book keeping for one child lint process spawned by -Processes. */
+struct FLintChildProcess
+{
+	int32 ShardIndex = 0;
+	int32 NumLaunches = 0;
+	FProcHandle ProcessHandle;
+	FString ReportPath;
+	FString ProgressPath;
+	FString SkipPackagesPath;
+	FString SuspectPackagesPath;
+	FString LogPath;
+
+	/** Full names ("Class /Path/Package.Asset") of every asset that crashed this child so far. */
+	TArray<FString> CrashedAssetFullNames;
+
+	/** Assets that were being linted together when this child last crashed. The next launch lints them one at a time to find out which one it was. */
+	TArray<FString> SuspectAssetFullNames;
+
+	/** Packages completely linted by launches that later crashed, which later launches skip, and their report entries. */
+	TArray<FString> FinishedPackageNames;
+	TArray<TSharedPtr<FJsonValue>> FinishedViolatorJsonValues;
+
+	bool bFinished = false;
+	bool bFailed = false;
+
+	/** Seconds from launching every child until this one finished, including restarts. */
+	double FinishedSeconds = 0.0;
+};
+
+/** How many times a single child process may be launched before its slice is considered a failure. */
+static const int32 MaxChildProcessLaunches = 16;
 
-			FullOutputPath = FPaths::ConvertRelativePathToFull(FullOutputPath);
-			IFileManager::Get().MakeDirectory(*FPaths::GetPath(FullOutputPath), true);
+/** Rebuilds this process' own command line for a child process, leaving out everything the parent controls per child. */
+static FString BuildChildProcessBaseParams()
+{
+	TArray<FString> Tokens;
+	TArray<FString> ChildSwitches;
+	TMap<FString, FString> ChildParamsMap;
+	UCommandlet::ParseCommandLine(FCommandLine::Get(), Tokens, ChildSwitches, ChildParamsMap);
 
-			UE_LOG(LinterCommandlet, Display, TEXT("Exporting JSON report to %s"), *FullOutputPath);
-			if (FFileHelper::SaveStringToFile(JsonReport, *FullOutputPath))
+	static const TCHAR* ParentOnlyArgs[] = { TEXT("Processes"), TEXT("Shard"), TEXT("json"), TEXT("html"), TEXT("MergeReports"), TEXT("LintProgressFile"), TEXT("SkipPackages"), TEXT("SuspectPackages"), TEXT("VerifyAssetRegistrySnapshot"), TEXT("abslog") };
+	auto IsParentOnlyArg = [](const FString& Arg)
+	{
+		for (const TCHAR* ParentOnlyArg : ParentOnlyArgs)
+		{
+			if (Arg.Equals(ParentOnlyArg, ESearchCase::IgnoreCase))
 			{
-				UE_LOG(LinterCommandlet, Display, TEXT("Exported JSON report successfully."));
+				return true;
 			}
-			else
+		}
+		return false;
+	};
+
+	FString ChildParams;
+	for (const FString& Token : Tokens)
+	{
+		ChildParams += FString::Printf(TEXT("\"%s\" "), *Token);
+	}
+
+	for (const FString& Switch : ChildSwitches)
+	{
+		if (!IsParentOnlyArg(Switch))
+		{
+			ChildParams += FString::Printf(TEXT("-%s "), *Switch);
+		}
+	}
+
+	for (const TPair<FString, FString>& Param : ChildParamsMap)
+	{
+		if (!IsParentOnlyArg(Param.Key))
+		{
+			ChildParams += FString::Printf(TEXT("-%s=\"%s\" "), *Param.Key, *Param.Value);
+		}
+	}
+
+	return ChildParams;
+}
+
+/** Returns the package names of the given asset full names ("Class /Path/Package.Asset"). */
+static TArray<FString> GetPackageNames(const TArray<FString>& AssetFullNames)
+{
+	TArray<FString> PackageNames;
+	for (const FString& AssetFullName : AssetFullNames)
+	{
+		FString ObjectPath;
+		AssetFullName.Split(TEXT(" "), nullptr, &ObjectPath);
+		PackageNames.Add(FPackageName::ObjectPathToPackageName(ObjectPath));
+	}
+	return PackageNames;
+}
+
+static bool LaunchChildProcess(FLintChildProcess& Child, int32 NumProcesses, const FString& BaseChildParams)
+{
+	TArray<FString> SkipPackageNames = GetPackageNames(Child.CrashedAssetFullNames);
+	SkipPackageNames.Append(Child.FinishedPackageNames);
+	FFileHelper::SaveStringArrayToFile(SkipPackageNames, *Child.SkipPackagesPath);
+	FFileHelper::SaveStringArrayToFile(GetPackageNames(Child.SuspectAssetFullNames), *Child.SuspectPackagesPath);
+
+	IFileManager::Get().Delete(*Child.ReportPath, false, true, true);
+	IFileManager::Get().Delete(*Child.ProgressPath, false, true, true);
+
+	const FString ChildParams = FString::Printf(TEXT("%s-Shard=%d/%d -json=\"%s\" -LintProgressFile=\"%s\" -SkipPackages=\"%s\" -SuspectPackages=\"%s\" -abslog=\"%s\""),
+		*BaseChildParams, Child.ShardIndex, NumProcesses, *Child.ReportPath, *Child.ProgressPath, *Child.SkipPackagesPath, *Child.SuspectPackagesPath, *Child.LogPath);
+
+	UE_LOG(LinterCommandlet, Display, TEXT("Launching Linter child process %d (launch %d): %s"), Child.ShardIndex, Child.NumLaunches + 1, *ChildParams);
+
+	Child.NumLaunches++;
+	Child.ProcessHandle = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *ChildParams, false, true, true, nullptr, 0, nullptr, nullptr);
+	return Child.ProcessHandle.IsValid();
+}
+
+/**
+ * Child processes write one tab separated line to their progress file for every step of every asset:
+ *   Started	<asset full name>
+ *   Checked	<asset full name>
+ *   Finished	<package name>	<the asset's report entries, as a condensed JSON array>
+ * followed by a single Completed line once linting is done and only the report is left to write.
+ */
+static const TCHAR* LintProgressStarted = TEXT("Started");
+static const TCHAR* LintProgressChecked = TEXT("Checked");
+static const TCHAR* LintProgressFinished = TEXT("Finished");
+static const TCHAR* LintProgressCompleted = TEXT("Completed");
+
+/** Records the progress of a child process' lint, flushing every line so it survives the child crashing. */
+class FLintProgressFileWriter : public ILintAssetsProgress
+{
+public:
+	FLintProgressFileWriter(const FString& ProgressPath)
+		: Writer(IFileManager::Get().CreateFileWriter(*ProgressPath, FILEWRITE_AllowRead))
+	{
+	}
+
+	virtual void OnAssetStarted(const FAssetData& Asset) override
+	{
+		WriteLine(FString::Printf(TEXT("%s\t%s"), LintProgressStarted, *Asset.GetFullName()));
+	}
+
+	virtual void OnAssetChecked(const FAssetData& Asset) override
+	{
+		WriteLine(FString::Printf(TEXT("%s\t%s"), LintProgressChecked, *Asset.GetFullName()));
+	}
+
+	virtual void OnAssetFinished(const FAssetData& Asset, const TArray<FLintRuleViolation>& RuleViolations) override
+	{
+		FString ViolatorsString;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&ViolatorsString);
+		FJsonSerializer::Serialize(BuildJsonReport(RuleViolations)->GetArrayField(TEXT("Violators")), JsonWriter);
+
+		WriteLine(FString::Printf(TEXT("%s\t%s\t%s"), LintProgressFinished, *Asset.PackageName.ToString(), *ViolatorsString));
+	}
+
+	/** Records that every asset has been linted, so a crash from here on can't be blamed on any of them. */
+	void MarkCompleted()
+	{
+		WriteLine(LintProgressCompleted);
+	}
+
+private:
+	void WriteLine(const FString& Line)
+	{
+		if (Writer.IsValid())
+		{
+			FTCHARToUTF8 ProgressLine(*(Line + LINE_TERMINATOR));
+			Writer->Serialize((void*)ProgressLine.Get(), ProgressLine.Length());
+			Writer->Flush();
+		}
+	}
+
+	TUniquePtr<FArchive> Writer;
+};
+
+/** What a child process recorded in its progress file before it exited. */
+struct FLintChildProgress
+{
+	/** Assets that may have crashed the child: those started but not checked, or if there are none, those checked but still waiting for batched rules. */
+	TArray<FString> SuspectAssetFullNames;
+
+	/** Packages whose assets were completely linted, and their report entries. */
+	TArray<FString> FinishedPackageNames;
+	TArray<TSharedPtr<FJsonValue>> FinishedViolatorJsonValues;
+
+	/** True if the child got past linting every asset. */
+	bool bCompleted = false;
+};
+
+static FLintChildProgress ReadChildProgress(const FString& ProgressPath)
+{
+	TArray<FString> ProgressLines;
+	FFileHelper::LoadFileToStringArray(ProgressLines, *ProgressPath);
+
+	FLintChildProgress Progress;
+	TArray<FString> StartedAssetFullNames;
+	TSet<FString> CheckedAssetFullNames;
+	for (const FString& ProgressLine : ProgressLines)
+	{
+		FString Step;
+		FString Value;
+		if (!ProgressLine.Split(TEXT("\t"), &Step, &Value))
+		{
+			Progress.bCompleted |= ProgressLine.Equals(LintProgressCompleted);
+			continue;
+		}
+
+		if (Step.Equals(LintProgressStarted))
+		{
+			StartedAssetFullNames.Add(Value);
+		}
+		else if (Step.Equals(LintProgressChecked))
+		{
+			CheckedAssetFullNames.Add(Value);
+		}
+		else if (Step.Equals(LintProgressFinished))
+		{
+			FString PackageName;
+			FString ViolatorsString;
+			TArray<TSharedPtr<FJsonValue>> ViolatorJsonValues;
+			if (Value.Split(TEXT("\t"), &PackageName, &ViolatorsString) && FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ViolatorsString), ViolatorJsonValues))
 			{
-				UE_LOG(LinterCommandlet, Error, TEXT("Failed to export JSON report. Aborting. Returning error code 1."));
-				return 1;
+				Progress.FinishedPackageNames.Add(PackageName);
+				Progress.FinishedViolatorJsonValues.Append(ViolatorJsonValues);
 			}
 		}
+	}
+
+	const TSet<FString> FinishedPackageNameSet(Progress.FinishedPackageNames);
+	TArray<FString> UnfinishedAssetFullNames;
+	for (const FString& StartedAssetFullName : StartedAssetFullNames)
+	{
+		FString ObjectPath;
+		StartedAssetFullName.Split(TEXT(" "), nullptr, &ObjectPath);
+		if (FinishedPackageNameSet.Contains(FPackageName::ObjectPathToPackageName(ObjectPath)))
+		{
+			continue;
+		}
+
+		if (CheckedAssetFullNames.Contains(StartedAssetFullName))
+		{
+			UnfinishedAssetFullNames.Add(StartedAssetFullName);
+		}
+		else
+		{
+			Progress.SuspectAssetFullNames.Add(StartedAssetFullName);
+		}
+	}
+
+	if (Progress.SuspectAssetFullNames.Num() == 0)
+	{
+		Progress.SuspectAssetFullNames = MoveTemp(UnfinishedAssetFullNames);
+	}
+
+	return Progress;
+}
+
+/** Builds a report entry recording that linting the given asset crashed a child process. */
+static TSharedPtr<FJsonValue> MakeCrashedAssetJsonValue(const FString& AssetFullName)
+{
+	FString ObjectPath;
+	AssetFullName.Split(TEXT(" "), nullptr, &ObjectPath);
+
+	TSharedPtr<FJsonObject> AssetJsonObject = MakeShareable(new FJsonObject);
+	AssetJsonObject->SetStringField(TEXT("ViolatorAssetName"), FPackageName::ObjectPathToObjectName(ObjectPath));
+	AssetJsonObject->SetStringField(TEXT("ViolatorAssetPath"), ObjectPath);
+	AssetJsonObject->SetStringField(TEXT("ViolatorFullName"), AssetFullName);
+
+	TSharedPtr<FJsonObject> RuleJsonObject = MakeShareable(new FJsonObject);
+	RuleJsonObject->SetStringField(TEXT("RuleGroup"), TEXT("Linter"));
+	RuleJsonObject->SetStringField(TEXT("RuleTitle"), TEXT("Asset crashed the Linter"));
+	RuleJsonObject->SetStringField(TEXT("RuleDesc"), TEXT("The Linter process crashed while loading or linting this asset, so it could not be checked."));
+	RuleJsonObject->SetStringField(TEXT("RuleURL"), TEXT(""));
+	RuleJsonObject->SetNumberField(TEXT("RuleSeverity"), (int32)ELintRuleSeverity::Error);
+	RuleJsonObject->SetStringField(TEXT("RuleRecommendedAction"), TEXT("Open this asset in the editor and check the crashed child process' log to investigate."));
+
+	TArray<TSharedPtr<FJsonValue>> RuleViolationJsonObjects;
+	RuleViolationJsonObjects.Push(MakeShareable(new FJsonValueObject(RuleJsonObject)));
+	AssetJsonObject->SetArrayField(TEXT("Violations"), RuleViolationJsonObjects);
+
+	return MakeShareable(new FJsonValueObject(AssetJsonObject));
+}
+
+/**
+ * Lints the requested paths by spawning NumProcesses child commandlets, each linting one shard.
+ * Children that crash are restarted without the asset that crashed them, and that asset is reported as a violation.
+ * Restarted children skip every package an earlier launch finished, whose results are merged in from its progress file.
+ */
+static int32 RunChildProcesses(int32 NumProcesses, const TArray<FString>& Switches, const TMap<FString, FString>& ParamsMap)
+{
+	const FString WorkingDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectIntermediateDir() / TEXT("Linter") / TEXT("Processes") / FGuid::NewGuid().ToString());
+	IFileManager::Get().MakeDirectory(*WorkingDir, true);
+
+	const FString BaseChildParams = BuildChildProcessBaseParams();
 
-		// write HTML report if requested
-		if (Switches.Contains(TEXT("html")) || ParamsMap.Contains(FString(TEXT("html"))))
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<FLintChildProcess> Children;
+	Children.SetNum(NumProcesses);
+	for (int32 ShardIndex = 0; ShardIndex < NumProcesses; ++ShardIndex)
+	{
+		FLintChildProcess& Child = Children[ShardIndex];
+		Child.ShardIndex = ShardIndex;
+		Child.ReportPath = WorkingDir / FString::Printf(TEXT("shard-%d.json"), ShardIndex);
+		Child.ProgressPath = WorkingDir / FString::Printf(TEXT("shard-%d.progress"), ShardIndex);
+		Child.SkipPackagesPath = WorkingDir / FString::Printf(TEXT("shard-%d.skip"), ShardIndex);
+		Child.SuspectPackagesPath = WorkingDir / FString::Printf(TEXT("shard-%d.suspects"), ShardIndex);
+		Child.LogPath = WorkingDir / FString::Printf(TEXT("shard-%d.log"), ShardIndex);
+
+		if (!LaunchChildProcess(Child, NumProcesses, BaseChildParams))
 		{
-			FDateTime Now = FDateTime::Now();
-			FString HtmlOutputName = TEXT("lint-report-") + FDateTime::Now().ToString() + TEXT(".html");
+			UE_LOG(LinterCommandlet, Error, TEXT("Failed to launch Linter child process %d."), ShardIndex);
+			Child.bFinished = true;
+			Child.bFailed = true;
+		}
+	}
 
-			const FString LintReportPath = FPaths::ProjectSavedDir() / TEXT("LintReports");
-			FString FullOutputPath = LintReportPath / HtmlOutputName;
+	int32 NumRunningChildren = Children.FilterByPredicate([](const FLintChildProcess& Child) { return !Child.bFinished; }).Num();
+	while (NumRunningChildren > 0)
+	{
+		FPlatformProcess::Sleep(0.25f);
 
-			if (ParamsMap.Contains(FString(TEXT("html"))))
+		for (FLintChildProcess& Child : Children)
+		{
+			if (Child.bFinished || FPlatformProcess::IsProcRunning(Child.ProcessHandle))
 			{
-				const FString HtmlOutputOverride = *ParamsMap.FindChecked(TEXT("html"));
-				if (FPaths::IsRelative(HtmlOutputName))
-				{
-					HtmlOutputName = HtmlOutputOverride;
-					FullOutputPath = LintReportPath / HtmlOutputName;
-				}
-				else
-				{
-					FullOutputPath = HtmlOutputOverride;
-				}
+				continue;
 			}
 
-			FullOutputPath = FPaths::ConvertRelativePathToFull(FullOutputPath);
-			IFileManager::Get().MakeDirectory(*FPaths::GetPath(FullOutputPath), true);
-			UE_LOG(LinterCommandlet, Display, TEXT("Exporting HTML report to %s"), *FullOutputPath);
+			int32 ReturnCode = -1;
+			FPlatformProcess::GetProcReturnCode(Child.ProcessHandle, &ReturnCode);
+			FPlatformProcess::CloseProc(Child.ProcessHandle);
 
-			FString TemplatePath = FPaths::Combine(*IPluginManager::Get().FindPlugin(TEXT("Linter"))->GetBaseDir(), TEXT("Resources"), TEXT("LintReportTemplate.html"));
-			UE_LOG(LinterCommandlet, Display, TEXT("Loading HTML report template from %s"), *TemplatePath);
+			// 0 and 2 are the regular "lint passed" and "lint found errors" results, 1 is a regular failure that a restart won't fix
+			if (ReturnCode == 0 || ReturnCode == 2 || ReturnCode == 1)
+			{
+				Child.FinishedSeconds = FPlatformTime::Seconds() - StartTime;
+				UE_LOG(LinterCommandlet, Display, TEXT("Linter child process %d finished with code %d after %.1fs."), Child.ShardIndex, ReturnCode, Child.FinishedSeconds);
+				Child.bFinished = true;
+				Child.bFailed = ReturnCode == 1;
+				NumRunningChildren--;
+				continue;
+			}
+
+			// Whatever this launch finished doesn't need linting again, whichever way it ended
+			FLintChildProgress Progress = ReadChildProgress(Child.ProgressPath);
+			Child.FinishedPackageNames.Append(Progress.FinishedPackageNames);
+			Child.FinishedViolatorJsonValues.Append(Progress.FinishedViolatorJsonValues);
 
-			FString HTMLReport;
-			if (FFileHelper::LoadFileToString(HTMLReport, *TemplatePath))
+			if (Progress.bCompleted || Progress.SuspectAssetFullNames.Num() == 0 || Child.NumLaunches >= MaxChildProcessLaunches)
 			{
-				UE_LOG(LinterCommandlet, Display, TEXT("Loading HTML report template successfully."));
+				const TCHAR* CrashReason = Progress.bCompleted ? TEXT(" after it finished linting") : Progress.SuspectAssetFullNames.Num() == 0 ? TEXT(" outside of any asset") : TEXT("");
+				UE_LOG(LinterCommandlet, Error, TEXT("Linter child process %d crashed with code %d%s and can not be recovered. See %s"), Child.ShardIndex, ReturnCode, CrashReason, *Child.LogPath);
+				Child.bFinished = true;
+				Child.bFailed = true;
+				NumRunningChildren--;
+				continue;
+			}
 
-				HTMLReport.ReplaceInline(TEXT("{% TITLE %}"), *FPaths::GetBaseFilename(FPaths::GetProjectFilePath()));
-				HTMLReport.ReplaceInline(TEXT("{% RESULTS %}"), *ResultsString);
-				HTMLReport.ReplaceInline(TEXT("{% LINT_REPORT %}"), *JsonReport);
+			if (Progress.SuspectAssetFullNames.Num() == 1)
+			{
+				const FString& CrashedAsset = Progress.SuspectAssetFullNames[0];
+				UE_LOG(LinterCommandlet, Warning, TEXT("Linter child process %d crashed with code %d while linting %s. Restarting without it, skipping %d finished packages."),
+					Child.ShardIndex, ReturnCode, *CrashedAsset, Child.FinishedPackageNames.Num());
+				Child.CrashedAssetFullNames.Add(CrashedAsset);
+				Child.SuspectAssetFullNames.Remove(CrashedAsset);
 			}
 			else
 			{
-				UE_LOG(LinterCommandlet, Error, TEXT("Failed to load HTML report template."));
-				return 1;
+				UE_LOG(LinterCommandlet, Warning, TEXT("Linter child process %d crashed with code %d while linting %d assets at once. Restarting to lint them one at a time, skipping %d finished packages."),
+					Child.ShardIndex, ReturnCode, Progress.SuspectAssetFullNames.Num(), Child.FinishedPackageNames.Num());
+				Child.SuspectAssetFullNames = Progress.SuspectAssetFullNames;
 			}
 
-			if (FFileHelper::SaveStringToFile(HTMLReport, *FullOutputPath))
+			if (!LaunchChildProcess(Child, NumProcesses, BaseChildParams))
 			{
-				UE_LOG(LinterCommandlet, Display, TEXT("Exported HTML report successfully."));
+				UE_LOG(LinterCommandlet, Error, TEXT("Failed to relaunch Linter child process %d."), Child.ShardIndex);
+				Child.bFinished = true;
+				Child.bFailed = true;
+				NumRunningChildren--;
 			}
-			else
+		}
+	}
+
+	// Every child starts at once, so the run takes as long as the slowest child; the closer the others finish to it, the better the shards were balanced
+	double SlowestChildSeconds = 0.0;
+	double TotalChildSeconds = 0.0;
+	for (const FLintChildProcess& Child : Children)
+	{
+		SlowestChildSeconds = FMath::Max(SlowestChildSeconds, Child.FinishedSeconds);
+		TotalChildSeconds += Child.FinishedSeconds;
+	}
+
+	if (SlowestChildSeconds > 0.0)
+	{
+		UE_LOG(LinterCommandlet, Display, TEXT("Child process load balance: %.0f%%. The slowest child took %.1fs, the average %.1fs."),
+			100.0 * TotalChildSeconds / (SlowestChildSeconds * NumProcesses), SlowestChildSeconds, TotalChildSeconds / NumProcesses);
+	}
+
+	TArray<FString> ReportFiles;
+	TArray<TSharedPtr<FJsonValue>> ExtraViolatorJsonValues;
+	for (const FLintChildProcess& Child : Children)
+	{
+		if (Child.bFailed)
+		{
+			UE_LOG(LinterCommandlet, Error, TEXT("Linter child process %d failed. Aborting. Returning error code 1. Child output kept in %s"), Child.ShardIndex, *WorkingDir);
+			return 1;
+		}
+
+		// The last launch's report only covers what earlier launches hadn't finished before crashing
+		ReportFiles.Add(Child.ReportPath);
+		ExtraViolatorJsonValues.Append(Child.FinishedViolatorJsonValues);
+		for (const FString& CrashedAssetFullName : Child.CrashedAssetFullNames)
+		{
+			ExtraViolatorJsonValues.Add(MakeCrashedAssetJsonValue(CrashedAssetFullName));
+		}
+	}
+
+	TSharedPtr<FJsonObject> MergedJsonObject = MergeJsonReports(ReportFiles);
+	if (!MergedJsonObject.IsValid())
+	{
+		UE_LOG(LinterCommandlet, Error, TEXT("Failed to merge child process reports. Aborting. Returning error code 1. Child output kept in %s"), *WorkingDir);
+		return 1;
+	}
+
+	if (ExtraViolatorJsonValues.Num() > 0)
+	{
+		TArray<TSharedPtr<FJsonValue>> ViolatorJsonValues = MergedJsonObject->GetArrayField(TEXT("Violators"));
+		ViolatorJsonValues.Append(ExtraViolatorJsonValues);
+		MergedJsonObject->SetArrayField(TEXT("Violators"), ViolatorJsonValues);
+	}
+
+	IFileManager::Get().DeleteDirectory(*WorkingDir, false, true);
+
+	return FinishJsonReport(MergedJsonObject, Switches, ParamsMap);
+}
+
+int32 ULinterCommandlet::Main(const FString& InParams)
+{
+	FString Params = InParams;
+	// Parse command line.
+	TArray<FString> Paths;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	UCommandlet::ParseCommandLine(*Params, Paths, Switches, ParamsMap);
+
+	UE_LOG(LinterCommandlet, Display, TEXT("Linter is indeed running!"));
+
+	// Merging shard reports does not lint anything, so it doesn't need the asset registry or a rule set
+	if (ParamsMap.Contains(TEXT("MergeReports")))
+	{
+		UE_LOG(LinterCommandlet, Display, TEXT("Merging lint reports..."));
+		TSharedPtr<FJsonObject> MergedJsonObject = MergeJsonReports(ResolveReportFiles(ParamsMap.FindChecked(TEXT("MergeReports"))));
+		if (!MergedJsonObject.IsValid())
+		{
+			UE_LOG(LinterCommandlet, Error, TEXT("Failed to merge lint reports. Aborting. Returning error code 1."));
+			return 1;
+		}
+
+		return FinishJsonReport(MergedJsonObject, Switches, ParamsMap);
+	}
+
+	// Renames touch referencers outside of any one shard, so they have to happen in a single process that saw every violation
+	if (Switches.Contains(TEXT("AutoFix")) && (ParamsMap.Contains(TEXT("Processes")) || ParamsMap.Contains(TEXT("Shard"))))
+	{
+		UE_LOG(LinterCommandlet, Error, TEXT("-AutoFix can not be combined with -Processes or -Shard. Aborting. Returning error code 1."));
+		PrintUsage();
+		return 1;
+	}
+
+	if (ParamsMap.Contains(TEXT("Processes")))
+	{
+		const int32 NumProcesses = FCString::Atoi(*ParamsMap.FindChecked(TEXT("Processes")));
+		if (NumProcesses < 1)
+		{
+			UE_LOG(LinterCommandlet, Error, TEXT("Invalid -Processes=%s, expected a positive number of processes. Aborting. Returning error code 1."), *ParamsMap.FindChecked(TEXT("Processes")));
+			return 1;
+		}
+
+		// Bring the snapshot up to date once here, so every child can load it without rescanning anything
+		bool bScannedAllAssets = false;
+		if (ParamsMap.Contains(TEXT("AssetRegistrySnapshot")) && !LoadAssetRegistry(Switches, ParamsMap, TArray<FString>(), /*bSaveSnapshot =*/true, bScannedAllAssets))
+		{
+			UE_LOG(LinterCommandlet, Error, TEXT("Asset registry snapshot doesn't match the project. Aborting. Returning error code 1."));
+			return 1;
+		}
+
+		return RunChildProcesses(NumProcesses, Switches, ParamsMap);
+	}
+
+	int32 ShardIndex = 0;
+	int32 NumShards = 1;
+	if (ParamsMap.Contains(TEXT("Shard")) && !ParseShard(ParamsMap.FindChecked(TEXT("Shard")), ShardIndex, NumShards))
+	{
+		UE_LOG(LinterCommandlet, Error, TEXT("Invalid -Shard=%s, expected -Shard=Index/Count with 0 <= Index < Count. Aborting. Returning error code 1."), *ParamsMap.FindChecked(TEXT("Shard")));
+		PrintUsage();
+		return 1;
+	}
+
+	if (Paths.Num() == 0)
+	{
+		Paths.Add(TEXT("/Game"));
+	}
+
+	// Linting the default /Game still benefits from skipping engine and plugin content, but not when a snapshot of everything was asked for
+	bool bScannedAllAssets = false;
+	if (!LoadAssetRegistry(Switches, ParamsMap, Paths, /*bSaveSnapshot =*/!ParamsMap.Contains(TEXT("LintProgressFile")), bScannedAllAssets))
+	{
+		UE_LOG(LinterCommandlet, Error, TEXT("Asset registry snapshot doesn't match the project. Aborting. Returning error code 1."));
+		return 1;
+	}
+	UE_LOG(LinterCommandlet, Display, TEXT("Finished loading the asset registry. Determining Rule Set..."));
+
+	// -RuleSet=A,B lints with several rule sets in the same pass, so each asset is loaded once no matter how many rule sets check it
+	TArray<const ULintRuleSet*> RuleSets;
+	if (ParamsMap.Contains(TEXT("RuleSet")))
+	{
+		TArray<FString> RuleSetNames;
+		ParamsMap.FindChecked(TEXT("RuleSet")).ParseIntoArray(RuleSetNames, TEXT(","));
+		bool bScannedAllRuleSets = bScannedAllAssets;
+		for (FString RuleSetName : RuleSetNames)
+		{
+			RuleSetName.TrimStartAndEndInline();
+			UE_LOG(LinterCommandlet, Display, TEXT("Trying to find Rule Set with Commandlet Name: %s"), *RuleSetName);
+
+			ULintRuleSet* FoundRuleSet = FindRuleSetForCommandlet(RuleSetName);
+			if (FoundRuleSet == nullptr && !bScannedAllRuleSets)
 			{
-				UE_LOG(LinterCommandlet, Error, TEXT("Failed to export HTML report. Aborting. Returning error code 1."));
-				return 1;
+				// Project specific rule sets may live anywhere, so look everywhere before giving up on the name
+				UE_LOG(LinterCommandlet, Display, TEXT("No Rule Set named %s in the scanned paths. Scanning the whole project..."), *RuleSetName);
+				FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get().SearchAllAssets(/*bSynchronousSearch =*/true);
+				bScannedAllRuleSets = true;
+				FoundRuleSet = FindRuleSetForCommandlet(RuleSetName);
 			}
+
+			if (FoundRuleSet == nullptr)
+			{
+				UE_LOG(LinterCommandlet, Warning, TEXT("Failed to find a rule set named %s. Ignoring it."), *RuleSetName);
+				continue;
+			}
+
+			RuleSets.AddUnique(FoundRuleSet);
+		}
+
+		if (RuleSets.Num() == 0)
+		{
+			UE_LOG(LinterCommandlet, Warning, TEXT("None of the rule sets named by -RuleSet=%s were found. Falling back to the default rule set."), *ParamsMap.FindChecked(TEXT("RuleSet")));
 		}
 	}
+	else
+	{
+		UE_LOG(LinterCommandlet, Display, TEXT("Using default rule set..."));
+	}
 
-	if (NumErrors > 0 || Switches.Contains(TEXT("TreatWarningsAsErrors")) && NumWarnings > 0)
+	if (RuleSets.Num() == 0)
 	{
-		UE_LOG(LinterCommandlet, Display, TEXT("Lint completed with errors. Returning error code 2."));
-		return 2;
+		if (const ULintRuleSet* DefaultRuleSet = GetDefault<ULinterSettings>()->DefaultLintRuleSet.LoadSynchronous())
+		{
+			RuleSets.Add(DefaultRuleSet);
+		}
 	}
 
-	return 0;
-}
\ No newline at end of file
+	if (RuleSets.Num() == 0)
+	{
+		UE_LOG(LinterCommandlet, Error, TEXT("Failed to load a rule set. Aborting. Returning error code 1."));
+		return 1;
+	}
+
+	for (const ULintRuleSet* RuleSet : RuleSets)
+	{
+		UE_LOG(LinterCommandlet, Display, TEXT("Using rule set: %s"), *RuleSet->GetFullName());
+	}
+
+	UE_LOG(LinterCommandlet, Display, TEXT("Attempting to Lint paths: %s"), *FString::Join(Paths, TEXT(", ")));
+
+	TArray<FAssetData> AssetList = ULintRuleSet::GatherAssetsInPaths(Paths, /*bSearchAllAssets =*/false);
+
+	if (NumShards > 1)
+	{
+		const int32 NumAssetsFound = AssetList.Num();
+		AssetList.RemoveAll([ShardIndex, NumShards](const FAssetData& Asset) { return !IsPackageInShard(Asset.PackageName, ShardIndex, NumShards); });
+		UE_LOG(LinterCommandlet, Display, TEXT("Linting shard %d/%d: %d of %d assets."), ShardIndex, NumShards, AssetList.Num(), NumAssetsFound);
+	}
+
+	if (ParamsMap.Contains(TEXT("SkipPackages")))
+	{
+		TArray<FString> SkipPackageNames;
+		FFileHelper::LoadFileToStringArray(SkipPackageNames, *ParamsMap.FindChecked(TEXT("SkipPackages")));
+		const TSet<FString> SkipPackageNameSet(SkipPackageNames);
+		AssetList.RemoveAll([&SkipPackageNameSet](const FAssetData& Asset) { return SkipPackageNameSet.Contains(Asset.PackageName.ToString()); });
+		UE_LOG(LinterCommandlet, Display, TEXT("Skipping %d packages that were already linted or previously crashed the Linter."), SkipPackageNameSet.Num());
+	}
+
+	// Filter here rather than in LintAssets so child processes don't log a skip for every asset
+	const int32 NumSkippedAssets = ULintRuleSet::RemoveAssetsWithoutLintRules(RuleSets, AssetList);
+	if (NumSkippedAssets > 0)
+	{
+		UE_LOG(LinterCommandlet, Display, TEXT("Skipped loading %d assets that no lint rules apply to."), NumSkippedAssets);
+	}
+
+	TArray<FLintRuleViolation> RuleViolations;
+	if (ParamsMap.Contains(TEXT("LintProgressFile")))
+	{
+		// Child processes record every asset they start, check and finish, so that if the process crashes the parent knows
+		// which assets may have caused it and which are done. Assets that were in flight during an earlier crash are linted
+		// one at a time first, to find out which of them it was. Saving the cost history is left to runs in a single process.
+		FLintProgressFileWriter ProgressWriter(ParamsMap.FindChecked(TEXT("LintProgressFile")));
+		if (ParamsMap.Contains(TEXT("SuspectPackages")))
+		{
+			TArray<FString> SuspectPackageNames;
+			FFileHelper::LoadFileToStringArray(SuspectPackageNames, *ParamsMap.FindChecked(TEXT("SuspectPackages")));
+			const TSet<FString> SuspectPackageNameSet(SuspectPackageNames);
+
+			TArray<FAssetData> SuspectAssets = AssetList.FilterByPredicate([&SuspectPackageNameSet](const FAssetData& Asset) { return SuspectPackageNameSet.Contains(Asset.PackageName.ToString()); });
+			AssetList.RemoveAll([&SuspectPackageNameSet](const FAssetData& Asset) { return SuspectPackageNameSet.Contains(Asset.PackageName.ToString()); });
+			for (const FAssetData& SuspectAsset : SuspectAssets)
+			{
+				RuleViolations.Append(ULintRuleSet::LintAssets(RuleSets, { SuspectAsset }, nullptr, nullptr, &ProgressWriter));
+			}
+		}
+
+		RuleViolations.Append(ULintRuleSet::LintAssets(RuleSets, AssetList, nullptr, nullptr, &ProgressWriter));
+		ProgressWriter.MarkCompleted();
+	}
+	else
+	{
+		RuleViolations = ULintRuleSet::LintAssets(RuleSets, AssetList);
+		FLintCostHistory::Get().SaveIfDirty();
+	}
+
+	return FinishJsonReport(BuildJsonReport(RuleViolations), Switches, ParamsMap, &RuleViolations);
+}
@@ -11,12 +11,16 @@
 #include "Framework/MultiBox/MultiBoxExtender.h"
 #include "Framework/Commands/UIAction.h"
 #include "Delegates/IDelegateInstance.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Text/STextBlock.h"
 #include "TooltipEditor/TooltipTool.h"
+#include "LinterSettings.h"
+#include "LintResultCache.h"
 
 #define LOCTEXT_NAMESPACE "Linter"
 DEFINE_LOG_CATEGORY_STATIC(LinterContentBrowserExtensions, Log, All);
 
-void FLinterContentBrowserExtensions::InstallHooks(FLinterModule* LinterModule, FDelegateHandle* pContentBrowserExtenderDelegateHandle, class FDelegateHandle* pAssetExtenderDelegateHandle)
+void FLinterContentBrowserExtensions::InstallHooks(FLinterModule* LinterModule, FDelegateHandle* pContentBrowserExtenderDelegateHandle, class FDelegateHandle* pAssetExtenderDelegateHandle, FDelegateHandle* pAssetViewExtraStateDelegateHandle)
 {
 	struct Local
 	{
@@ -49,16 +53,85 @@ void FLinterContentBrowserExtensions::InstallHooks(FLinterModule* LinterModule,
 							if (lm != nullptr)
 							{
 								lm->SetDesiredLintPaths(SelectedPaths);
+								lm->SetPriorityLintPaths(SelectedPaths);
 							}
 							FGlobalTabmanager::Get()->InvokeTab(FName("LinterTab"));
 						}
 					})),
 					NAME_None,
 					EUserInterfaceActionType::Button);
+
+				// Folder totals are kept rolled up by the result cache, so this doesn't walk the assets under the selection
+				FLintStatusCounts FolderStatus;
+				for (const FString& SelectedPath : SelectedPaths)
+				{
+					FString FolderPath = SelectedPath;
+					FolderPath.RemoveFromEnd(TEXT("/"));
+					const FLintStatusCounts PathStatus = FLintResultCache::Get().GetFolderStatus(GetDefaultRuleSetPath(), FName(*FolderPath));
+					FolderStatus.NumErrors += PathStatus.NumErrors;
+					FolderStatus.NumWarnings += PathStatus.NumWarnings;
+				}
+
+				if (FolderStatus.HasViolations())
+				{
+					MenuBuilder.AddWidget(
+						SNew(STextBlock)
+						.Text(FText::Format(LOCTEXT("CB_FolderLintStatus", "Last lint: {0} errors, {1} warnings"), FText::AsNumber(FolderStatus.NumErrors), FText::AsNumber(FolderStatus.NumWarnings)))
+						.ToolTipText(LOCTEXT("CB_FolderLintStatus_Tooltip", "Totals of the cached lint results of every asset in the selected folders, using the default rule set")),
+						FText::GetEmpty());
+				}
 			}
 			MenuBuilder.EndSection();
 		}
 
+		// Lint status badges
+
+		static FName GetDefaultRuleSetPath()
+		{
+			return GetDefault<ULinterSettings>()->DefaultLintRuleSet.ToSoftObjectPath().GetAssetPathName();
+		}
+
+		static FLintStatusCounts GetPackageStatus(FName PackageName)
+		{
+			return FLintResultCache::Get().GetPackageStatus(GetDefaultRuleSetPath(), PackageName);
+		}
+
+		// Both generators read the cache through attributes, so badges stay current without regenerating tiles
+		static TSharedRef<SWidget> OnGenerateLintStatusIcon(const FAssetData& AssetData)
+		{
+			const FName PackageName = AssetData.PackageName;
+			return SNew(SImage)
+				.Image_Lambda([PackageName]()
+				{
+					return FLinterStyle::Get()->GetBrush(GetPackageStatus(PackageName).NumErrors > 0 ? "Linter.Report.Error" : "Linter.Report.Warning");
+				})
+				.ColorAndOpacity_Lambda([PackageName]()
+				{
+					// Results from before the asset was last saved are only a hint
+					return GetPackageStatus(PackageName).bUpToDate ? FLinearColor::White : FLinearColor(1.0f, 1.0f, 1.0f, 0.4f);
+				})
+				.Visibility_Lambda([PackageName]()
+				{
+					return GetPackageStatus(PackageName).HasViolations() ? EVisibility::Visible : EVisibility::Collapsed;
+				});
+		}
+
+		static TSharedRef<SWidget> OnGenerateLintStatusToolTip(const FAssetData& AssetData)
+		{
+			const FName PackageName = AssetData.PackageName;
+			return SNew(STextBlock)
+				.Text_Lambda([PackageName]()
+				{
+					const FLintStatusCounts Status = GetPackageStatus(PackageName);
+					const FText StatusText = FText::Format(LOCTEXT("CB_AssetLintStatus", "Linter: {0} errors, {1} warnings"), FText::AsNumber(Status.NumErrors), FText::AsNumber(Status.NumWarnings));
+					return Status.bUpToDate ? StatusText : FText::Format(LOCTEXT("CB_AssetLintStatusOutOfDate", "{0} (modified since last lint)"), StatusText);
+				})
+				.Visibility_Lambda([PackageName]()
+				{
+					return GetPackageStatus(PackageName).HasViolations() ? EVisibility::Visible : EVisibility::Collapsed;
+				});
+		}
+
 		// Asset extensions
 
 		static TSharedRef<FExtender> OnExtendAssetSelectionMenu(const TArray<FAssetData>& SelectedAssets)
@@ -160,9 +233,14 @@ void FLinterContentBrowserExtensions::InstallHooks(FLinterModule* LinterModule,
 	TArray<FContentBrowserMenuExtender_SelectedAssets>& CBMenuAssetExtenderDelegates = ContentBrowserModule.GetAllAssetViewContextMenuExtenders();
 	CBMenuAssetExtenderDelegates.Add(FContentBrowserMenuExtender_SelectedAssets::CreateStatic(&Local::OnExtendAssetSelectionMenu));
 	*pAssetExtenderDelegateHandle = CBMenuAssetExtenderDelegates.Last().GetHandle();
+
+	// Asset view lint status badges
+	*pAssetViewExtraStateDelegateHandle = ContentBrowserModule.AddAssetViewExtraStateGenerator(FAssetViewExtraStateGenerator(
+		FOnGenerateAssetViewExtraStateIndicators::CreateStatic(&Local::OnGenerateLintStatusIcon),
+		FOnGenerateAssetViewExtraStateIndicators::CreateStatic(&Local::OnGenerateLintStatusToolTip)));
 }
 
-void FLinterContentBrowserExtensions::RemoveHooks(FLinterModule* LinterModule, FDelegateHandle* pContentBrowserExtenderDelegateHandle, FDelegateHandle* pAssetExtenderDelegateHandle)
+void FLinterContentBrowserExtensions::RemoveHooks(FLinterModule* LinterModule, FDelegateHandle* pContentBrowserExtenderDelegateHandle, FDelegateHandle* pAssetExtenderDelegateHandle, FDelegateHandle* pAssetViewExtraStateDelegateHandle)
 {
 	if (FModuleManager::Get().IsModuleLoaded("ContentBrowser"))
 	{
@@ -175,6 +253,9 @@ void FLinterContentBrowserExtensions::RemoveHooks(FLinterModule* LinterModule, F
 		// Asset extenders
 		TArray<FContentBrowserMenuExtender_SelectedAssets>& CBMenuAssetExtenderDelegates = ContentBrowserModule.GetAllAssetViewContextMenuExtenders();
 		CBMenuAssetExtenderDelegates.RemoveAll([pAssetExtenderDelegateHandle](const FContentBrowserMenuExtender_SelectedAssets & Delegate) { return Delegate.GetHandle() == *pAssetExtenderDelegateHandle; });
+
+		// Asset view lint status badges
+		ContentBrowserModule.RemoveAssetViewExtraStateGenerator(*pAssetViewExtraStateDelegateHandle);
 	}
 }
 
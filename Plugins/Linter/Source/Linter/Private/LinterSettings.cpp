@@ -1,7 +1,6 @@
 // Copyright 1998-2018 Epic Games, Inc. All Rights Reserved.
 
 #include "LinterSettings.h"
-#include "UObject/ConstructorHelpers.h"
 #include "LintRuleSet.h"
 
 
@@ -10,7 +9,7 @@ ULinterSettings::ULinterSettings(const FObjectInitializer& ObjectInitializer)
 {
 	if (DefaultLintRuleSet.IsNull())
 	{
-		static ConstructorHelpers::FObjectFinder<ULintRuleSet> DefaultMarketplaceRuleSetRef(TEXT("LintRuleSet'/Linter/MarketplaceLinter/MarketplaceLintRuleSet.MarketplaceLintRuleSet'"));
-		DefaultLintRuleSet = DefaultMarketplaceRuleSetRef.Object;
+		// Only the path, the rule set is loaded the first time something lints with it
+		DefaultLintRuleSet = FSoftObjectPath(TEXT("/Linter/MarketplaceLinter/MarketplaceLintRuleSet.MarketplaceLintRuleSet"));
 	}
 }
\ No newline at end of file
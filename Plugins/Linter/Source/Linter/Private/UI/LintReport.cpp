@@ -12,7 +12,8 @@
 #include "AssetThumbnail.h"
 #include "Containers/Map.h"
 #include "LinterSettings.h"
-#include "Misc/ScopedSlowTask.h"
+#include "AsyncLintJob.h"
+#include "LintResultCache.h"
 #include "Widgets/Layout/SSpacer.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonWriter.h"
@@ -24,13 +25,32 @@
 #include "Misc/FileHelper.h"
 #include "Widgets/Input/SComboButton.h"
 #include "UI/LintReportRuleDetails.h"
+#include "UI/LintReportRuleError.h"
+#include "UI/LintReportThumbnailCache.h"
+#include "UObject/Package.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Misc/MessageDialog.h"
+#include "BatchRenameTool/BatchRenamer.h"
+#include "AssetRegistryModule.h"
+#include "Linter.h"
 
 #define LOCTEXT_NAMESPACE "Linter"
 
+SLintReport::~SLintReport()
+{
+	UPackage::PackageSavedEvent.Remove(PackageSavedDelegateHandle);
+}
+
 void SLintReport::Construct(const FArguments& Args)
 {
 	const float PaddingAmount = FLinterStyle::Get()->GetFloat("Linter.Padding");
 
+	ThumbnailCache = MakeShareable(new FLintReportThumbnailCache(MaxThumbnails));
+	ThumbnailPool = MakeShareable(new FAssetThumbnailPool(MaxThumbnails, false));
+	RuleThumbnailPool = MakeShareable(new FAssetThumbnailPool(16)); // Incase we ever want to render 'rule thumbnails' in the future
+
+	PackageSavedDelegateHandle = UPackage::PackageSavedEvent.AddSP(this, &SLintReport::OnPackageSaved);
+
 	ChildSlot
 	[
 		SNew(SVerticalBox)
@@ -46,7 +66,28 @@ void SLintReport::Construct(const FArguments& Args)
 			[
 				SNew(SButton)
 				.Text(LOCTEXT("Rescan", "Rescan"))
-				.OnClicked_Lambda([this]() -> FReply { Rebuild(LastUsedRuleSet); return FReply::Handled(); })
+				.OnClicked_Lambda([this]() -> FReply { Rebuild(LastUsedRuleSets); return FReply::Handled(); })
+			]
+			+ SHorizontalBox::Slot()
+			.HAlign(HAlign_Left)
+			.AutoWidth()
+			.Padding(PaddingAmount)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("CancelLint", "Cancel"))
+				.Visibility_Lambda([this]() { return IsLinting() ? EVisibility::Visible : EVisibility::Collapsed; })
+				.OnClicked_Lambda([this]() -> FReply { CancelLint(); return FReply::Handled(); })
+			]
+			+ SHorizontalBox::Slot()
+			.HAlign(HAlign_Left)
+			.AutoWidth()
+			.Padding(PaddingAmount)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("FixNamingViolations", "Fix All Naming Violations"))
+				.ToolTipText(LOCTEXT("FixNamingViolationsTooltip", "Renames every asset with a naming violation to its recommended name, then rescans."))
+				.Visibility_Lambda([this]() { return !IsLinting() && NumSuggestedRenames > 0 ? EVisibility::Visible : EVisibility::Collapsed; })
+				.OnClicked_Lambda([this]() -> FReply { FixNamingViolations(); return FReply::Handled(); })
 			]
 			+ SHorizontalBox::Slot()
 			.HAlign(HAlign_Left)
@@ -101,6 +142,7 @@ void SLintReport::Construct(const FArguments& Args)
 					if (OutFilenames.Num() > 0)
 					{
 						FString WritePath = FPaths::ConvertRelativePathToFull(OutFilenames[0]);
+						UpdateExports();
 						FFileHelper::SaveStringToFile(JsonReport, *WritePath);
 						FPlatformProcess::LaunchURL(*WritePath, TEXT(""), nullptr);
 					}
@@ -145,6 +187,7 @@ void SLintReport::Construct(const FArguments& Args)
 					if (OutFilenames.Num() > 0)
 					{
 						FString WritePath = FPaths::ConvertRelativePathToFull(OutFilenames[0]);
+						UpdateExports();
 						FFileHelper::SaveStringToFile(HTMLReport, *WritePath);
 						FPlatformProcess::LaunchURL(*WritePath, TEXT(""), nullptr);
 					}
@@ -154,20 +197,33 @@ void SLintReport::Construct(const FArguments& Args)
 			]
 		]
 		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(PaddingAmount)
+		[
+			SNew(SSearchBox)
+			.HintText(LOCTEXT("SearchViolationsHint", "Search violations, i.e. severity:warning group:Naming class:Texture2D path:/Game/Characters"))
+			.OnTextChanged(this, &SLintReport::OnSearchTextChanged)
+		]
+		+ SVerticalBox::Slot()
 		.VAlign(VAlign_Fill)
 		.FillHeight(1.0f)
 		.Padding(PaddingAmount)
 		[
-			SAssignNew(AssetDetailsScrollBoxPtr, SScrollBox)
-			.ScrollBarAlwaysVisible(true)
+			SAssignNew(AssetDetailsListViewPtr, SListView<TSharedPtr<FLintReportAssetItem>>)
+			.SelectionMode(ESelectionMode::None)
+			.ListItemsSource(&FilteredAssetItems)
+			.OnGenerateRow(this, &SLintReport::OnGenerateAssetRow)
 		]
 		+ SVerticalBox::Slot()
 		.VAlign(VAlign_Fill)
 		.FillHeight(1.0f)
 		.Padding(PaddingAmount)
 		[
-			SAssignNew(RuleDetailsScrollBoxPtr, SScrollBox)
-			.ScrollBarAlwaysVisible(true)
+			SAssignNew(RuleDetailsTreeViewPtr, STreeView<TSharedPtr<FLintReportRuleItem>>)
+			.SelectionMode(ESelectionMode::None)
+			.TreeItemsSource(&FilteredRuleItems)
+			.OnGenerateRow(this, &SLintReport::OnGenerateRuleRow)
+			.OnGetChildren(this, &SLintReport::OnGetRuleChildren)
 			.Visibility(EVisibility::Collapsed)
 		]
 		// Bottom panel
@@ -224,35 +280,274 @@ void SLintReport::Construct(const FArguments& Args)
 
 void SLintReport::Rebuild(const ULintRuleSet* SelectedLintRuleSet)
 {
-	const float PaddingAmount = FLinterStyle::Get()->GetFloat("Linter.Padding");
+	if (SelectedLintRuleSet == nullptr)
+	{
+		SelectedLintRuleSet = GetDefault<ULinterSettings>()->DefaultLintRuleSet.LoadSynchronous();
+	}
+
+	check(SelectedLintRuleSet != nullptr);
+	Rebuild(TArray<const ULintRuleSet*>({ SelectedLintRuleSet }));
+}
+
+void SLintReport::Rebuild(const TArray<const ULintRuleSet*>& SelectedLintRuleSets)
+{
+	check(SelectedLintRuleSets.Num() > 0);
+
+	// Dropping the old job waits for its in-flight assets, which have already been asked to stop
+	CancelLint();
+	LintJob.Reset();
 
 	NumErrors = 0;
 	NumWarnings = 0;
+	NumSuggestedRenames = 0;
 	bHasRanReport = false;
 
-	if (SelectedLintRuleSet == nullptr)
+	LastUsedRuleSets = SelectedLintRuleSets;
+
+	AssetItems.Reset();
+	AssetItemsByPath.Reset();
+	RuleItems.Reset();
+	RuleItemsByRule.Reset();
+	SearchIndex.Reset();
+	ApplyFilter();
+	RuleViolations.Reset();
+	PendingRelintPackages.Reset();
+	JsonReport.Empty();
+	HTMLReport.Empty();
+	bExportsDirty = true;
+	bWasCancelled = false;
+
+	FLinterModule& LinterModule = FModuleManager::LoadModuleChecked<FLinterModule>(TEXT("Linter"));
+	LastLintPaths = LinterModule.GetDesiredLintPaths();
+
+	TArray<FAssetData> AssetList = ULintRuleSet::GatherAssetsInPaths(LastLintPaths);
+	FAsyncLintJob::PrioritizeAssetsInPaths(AssetList, LinterModule.GetPriorityLintPaths());
+
+	// Assets that haven't changed since they were last linted with every selected rule set, i.e. by the idle sweep, don't need linting again.
+	// An asset that is only up to date for some of them is linted again with all of them, so it is still loaded only once.
+	FLintResultCache& ResultCache = FLintResultCache::Get();
+	TArray<FAssetData> CachedAssetList;
+	AssetList.RemoveAll([&ResultCache, &SelectedLintRuleSets, &CachedAssetList](const FAssetData& Asset)
 	{
-		SelectedLintRuleSet = GetDefault<ULinterSettings>()->DefaultLintRuleSet.LoadSynchronous();
+		for (const ULintRuleSet* RuleSet : SelectedLintRuleSets)
+		{
+			if (!ResultCache.IsUpToDate(RuleSet, Asset.PackageName))
+			{
+				return false;
+			}
+		}
+
+		CachedAssetList.Add(Asset);
+		return true;
+	});
+
+	TArray<FLintRuleViolation> CachedRuleViolations;
+	for (const ULintRuleSet* RuleSet : SelectedLintRuleSets)
+	{
+		TArray<FAssetData> RuleSetCachedAssetList = CachedAssetList;
+		ResultCache.TakeUpToDateResults(RuleSet, RuleSetCachedAssetList, CachedRuleViolations);
 	}
+	AddToIndex(CachedRuleViolations);
 
-	check(SelectedLintRuleSet != nullptr);
-	LastUsedRuleSet = SelectedLintRuleSet;
+	LintJob = MakeShareable(new FAsyncLintJob(SelectedLintRuleSets, AssetList));
+	LintJob->Start();
 
-	AssetDetailsScrollBoxPtr->ClearChildren();
-	RuleDetailsScrollBoxPtr->ClearChildren();
-	RuleViolations.Reset();
+	ResultsTextBlockPtr->SetText(GetResultsSummary());
+}
 
-	FScopedSlowTask SlowTask(0, LOCTEXT("LintingInProgress", "Linting Assets..."));
-	SlowTask.MakeDialog(false);
+void SLintReport::CancelLint()
+{
+	if (LintJob.IsValid())
+	{
+		LintJob->Cancel();
+	}
+}
 
-	FLinterModule& LinterModule = FModuleManager::LoadModuleChecked<FLinterModule>(TEXT("Linter"));
-	TArray<FString> LintPaths = LinterModule.GetDesiredLintPaths();
+void SLintReport::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
 
-	RuleViolations = SelectedLintRuleSet->LintPathShared(LintPaths, &SlowTask);
+	if (LintJob.IsValid())
+	{
+		TArray<FLintRuleViolation> DrainedRuleViolations;
+		TArray<FAssetData> LintedAssets;
+		LintJob->DrainResults(DrainedRuleViolations, &LintedAssets);
+		for (const ULintRuleSet* RuleSet : LastUsedRuleSets)
+		{
+			FLintResultCache::Get().StoreResults(RuleSet, LintedAssets, DrainedRuleViolations);
+		}
+		AddToIndex(DrainedRuleViolations);
 
-	for (TSharedPtr<FLintRuleViolation> Violation : RuleViolations)
+		if (LintJob->IsFinished())
+		{
+			const bool bJobWasCancelled = LintJob->IsCancelled();
+			LintJob.Reset();
+			FinishReport(bJobWasCancelled);
+		}
+		else
+		{
+			ResultsTextBlockPtr->SetText(GetResultsSummary());
+		}
+	}
+	else if (PendingRelintPackages.Num() > 0 && bHasRanReport)
+	{
+		// Saved packages are re-linted here rather than while they're still being saved. Every saved package under the
+		// lint paths is re-linted, so assets that had no violations yet show up as soon as they get one
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		TMap<FName, FAssetData> AssetsToRelint;
+		for (const FName PendingPackageName : PendingRelintPackages)
+		{
+			const FString PackageName = PendingPackageName.ToString();
+			const bool bIsInLintPaths = LastLintPaths.ContainsByPredicate([&PackageName](FString LintPath)
+			{
+				LintPath.RemoveFromEnd(TEXT("/"));
+				return PackageName.Equals(LintPath, ESearchCase::IgnoreCase) || PackageName.StartsWith(LintPath + TEXT("/"), ESearchCase::IgnoreCase);
+			});
+
+			if (bIsInLintPaths)
+			{
+				TArray<FAssetData> PackageAssets;
+				AssetRegistry.GetAssetsByPackageName(PendingPackageName, PackageAssets);
+				for (const FAssetData& PackageAsset : PackageAssets)
+				{
+					AssetsToRelint.Add(PackageAsset.ObjectPath, PackageAsset);
+				}
+			}
+		}
+
+		// Rows of assets that were renamed or deleted by the save are dropped by re-linting them
+		for (const TSharedPtr<FLintReportAssetItem>& AssetItem : AssetItems)
+		{
+			if (PendingRelintPackages.Contains(AssetItem->AssetData.PackageName) && !AssetsToRelint.Contains(AssetItem->AssetData.ObjectPath))
+			{
+				AssetsToRelint.Add(AssetItem->AssetData.ObjectPath, AssetItem->AssetData);
+			}
+		}
+		PendingRelintPackages.Reset();
+
+		TArray<FAssetData> AssetList;
+		AssetsToRelint.GenerateValueArray(AssetList);
+		RelintAssets(AssetList);
+	}
+
+	// Streamed results are filtered once per tick rather than once per batch
+	if (bFilterDirty)
+	{
+		ApplyFilter();
+	}
+}
+
+void SLintReport::RelintAsset(const FAssetData& AssetData)
+{
+	RelintAssets(TArray<FAssetData>({ AssetData }));
+}
+
+void SLintReport::RelintAssets(const TArray<FAssetData>& AssetList)
+{
+	if (LastUsedRuleSets.Num() == 0 || IsLinting() || AssetList.Num() == 0)
 	{
-		if (Violation->ViolatedRule->GetDefaultObject<ULintRule>()->RuleSeverity <= ELintRuleSeverity::Error)
+		return;
+	}
+
+	// Assets may have been deleted or renamed since the report was built, in which case they simply drop out of the report.
+	// The asset registry is asked rather than loading each asset, which the job does a few at a time instead
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	TArray<FAssetData> ExistingAssetList;
+	for (const FAssetData& AssetData : AssetList)
+	{
+		RemoveFromIndex(AssetData.ObjectPath);
+		const FAssetData CurrentAssetData = AssetRegistry.GetAssetByObjectPath(AssetData.ObjectPath);
+		if (CurrentAssetData.IsValid() && !CurrentAssetData.IsRedirector())
+		{
+			ExistingAssetList.Add(CurrentAssetData);
+		}
+	}
+
+	// Results stream in through Tick like a full lint, which also stores them in the result cache
+	if (ExistingAssetList.Num() > 0)
+	{
+		LintJob = MakeShareable(new FAsyncLintJob(LastUsedRuleSets, ExistingAssetList));
+		LintJob->Start();
+	}
+
+	ApplyFilter();
+	ResultsTextBlockPtr->SetText(GetResultsSummary());
+}
+
+void SLintReport::FixNamingViolations()
+{
+	if (LastUsedRuleSets.Num() == 0 || IsLinting())
+	{
+		return;
+	}
+
+	// Suggested names come straight from the index, so cached violations don't need their assets loaded to be planned
+	TArray<FLintRuleViolation> NamingViolations;
+	for (const TSharedPtr<FLintRuleViolation>& Violation : RuleViolations)
+	{
+		if (!Violation->SuggestedName.IsEmpty())
+		{
+			NamingViolations.Add(*Violation);
+		}
+	}
+
+	const TArray<FBatchRenameEntry> Entries = FBatchRenamer::PlanFromSuggestedNames(NamingViolations);
+	const int32 NumConflicts = Entries.FilterByPredicate([](const FBatchRenameEntry& Entry) { return Entry.HasConflict(); }).Num();
+	const int32 NumToRename = Entries.Num() - NumConflicts;
+	if (NumToRename == 0)
+	{
+		FMessageDialog::Open(EAppMsgType::Ok, FText::Format(LOCTEXT("FixNamingViolationsNothingToDo", "None of the {0} suggested renames can be applied, since their names are taken or invalid."), NumConflicts));
+		return;
+	}
+
+	const FText Message = FText::Format(LOCTEXT("FixNamingViolationsConfirm", "Rename {0} {0}|plural(one=asset,other=assets) to their recommended names and fix up their references? {1} {1}|plural(one=rename,other=renames) will be skipped because the name is taken or invalid."), NumToRename, NumConflicts);
+	if (FMessageDialog::Open(EAppMsgType::YesNo, Message) != EAppReturnType::Yes)
+	{
+		return;
+	}
+
+	for (const FBatchRenameEntry& Entry : Entries)
+	{
+		if (Entry.HasConflict())
+		{
+			UE_LOG(LogLinter, Warning, TEXT("Skipped renaming \"%s\" to \"%s\": %s"), *Entry.AssetData.ObjectPath.ToString(), *Entry.NewName, *Entry.Conflict.ToString());
+		}
+	}
+
+	FBatchRenamer::Execute(Entries);
+
+	// Renamed assets have new paths, so the report is rebuilt rather than patched
+	Rebuild(LastUsedRuleSets);
+}
+
+bool SLintReport::ShowsMarketplacePublishingInfo() const
+{
+	return LastUsedRuleSets.ContainsByPredicate([](const ULintRuleSet* RuleSet) { return RuleSet->bShowMarketplacePublishingInfoInLintWizard; });
+}
+
+void SLintReport::OnPackageSaved(const FString& PackageFileName, UObject* Outer)
+{
+	if (UPackage* Package = Cast<UPackage>(Outer))
+	{
+		PendingRelintPackages.Add(Package->GetFName());
+	}
+}
+
+void SLintReport::AddToIndex(const TArray<FLintRuleViolation>& NewRuleViolations)
+{
+	if (NewRuleViolations.Num() == 0)
+	{
+		return;
+	}
+
+	for (const FLintRuleViolation& NewViolation : NewRuleViolations)
+	{
+		TSharedPtr<FLintRuleViolation> Violation = TSharedPtr<FLintRuleViolation>(new FLintRuleViolation(NewViolation));
+		Violation->PopulateAssetData();
+		RuleViolations.Add(Violation);
+
+		const ULintRule* LintRule = Violation->ViolatedRule->GetDefaultObject<ULintRule>();
+		if (LintRule->RuleSeverity <= ELintRuleSeverity::Error)
 		{
 			NumErrors++;
 		}
@@ -260,86 +555,274 @@ void SLintReport::Rebuild(const ULintRuleSet* SelectedLintRuleSet)
 		{
 			NumWarnings++;
 		}
+
+		if (!Violation->SuggestedName.IsEmpty())
+		{
+			NumSuggestedRenames++;
+		}
+
+		TSharedPtr<FLintReportAssetItem>& AssetItem = AssetItemsByPath.FindOrAdd(Violation->ViolatorAssetData.ObjectPath);
+		if (!AssetItem.IsValid())
+		{
+			AssetItem = MakeShared<FLintReportAssetItem>();
+			AssetItem->AssetData = Violation->ViolatorAssetData;
+			AssetItem->ItemIndex = AssetItems.Add(AssetItem);
+		}
+		const int32 SearchId = SearchIndex.Add(Violation);
+		AssetItem->RuleViolations.Add(Violation);
+		AssetItem->SearchIds.Add(SearchId);
+
+		TSharedPtr<FLintReportRuleItem>& RuleItem = RuleItemsByRule.FindOrAdd(LintRule);
+		if (!RuleItem.IsValid())
+		{
+			RuleItem = MakeShared<FLintReportRuleItem>();
+			RuleItem->Rule = LintRule;
+			RuleItems.Add(RuleItem);
+		}
+		RuleItem->RuleViolations.Add(Violation);
+
+		TSharedPtr<FLintReportRuleItem> ViolationItem = MakeShared<FLintReportRuleItem>();
+		ViolationItem->Rule = LintRule;
+		ViolationItem->RuleViolation = Violation;
+		ViolationItem->SearchId = SearchId;
+		ViolationItem->ChildIndex = RuleItem->Children.Add(ViolationItem);
+		AssetItem->ViolationItems.Add(ViolationItem);
 	}
 
-	TArray<UObject*> UniqueViolators = FLintRuleViolation::AllRuleViolationViolators(RuleViolations);
-	TSharedPtr<FAssetThumbnailPool> ThumbnailPool = MakeShareable(new FAssetThumbnailPool(UniqueViolators.Num()));
+	bExportsDirty = true;
+	bFilterDirty = true;
+}
 
-	TSharedPtr<FJsonObject> RootJsonObject = MakeShareable(new FJsonObject);
-	TArray<TSharedPtr<FJsonValue>> ViolatorJsonObjects;
+void SLintReport::RemoveFromIndex(FName ObjectPath)
+{
+	TSharedPtr<FLintReportAssetItem> AssetItem;
+	if (!AssetItemsByPath.RemoveAndCopyValue(ObjectPath, AssetItem))
+	{
+		return;
+	}
 
-	for (UObject* Violator : UniqueViolators)
+	// Swapping the last item into the gap keeps removal independent of how many assets are in the report
+	AssetItems.RemoveAtSwap(AssetItem->ItemIndex);
+	if (AssetItems.IsValidIndex(AssetItem->ItemIndex))
 	{
-		// We might as well build JSON data here as we're iterating through all our rule violations anyway
-		TSharedPtr<FJsonObject> AssetJsonObject = MakeShareable(new FJsonObject);
-		TArray<TSharedPtr<FLintRuleViolation>> UniqueViolatorViolations = FLintRuleViolation::AllRuleViolationsWithViolatorShared(RuleViolations, Violator);
+		AssetItems[AssetItem->ItemIndex]->ItemIndex = AssetItem->ItemIndex;
+	}
 
-		FAssetData AssetData;
-		if (UniqueViolatorViolations.Num() > 0)
+	for (int32 ViolationIndex = 0; ViolationIndex < AssetItem->RuleViolations.Num(); ++ViolationIndex)
+	{
+		const TSharedPtr<FLintRuleViolation>& Violation = AssetItem->RuleViolations[ViolationIndex];
+		const ULintRule* LintRule = Violation->ViolatedRule->GetDefaultObject<ULintRule>();
+		if (LintRule->RuleSeverity <= ELintRuleSeverity::Error)
 		{
-			AssetData = UniqueViolatorViolations[0]->ViolatorAssetData;
-			AssetJsonObject->SetStringField(TEXT("ViolatorAssetName"), AssetData.AssetName.ToString());
-			AssetJsonObject->SetStringField(TEXT("ViolatorAssetPath"), AssetData.ObjectPath.ToString());
-			AssetJsonObject->SetStringField(TEXT("ViolatorFullName"), AssetData.GetFullName());
-			//@TODO: Thumbnail export?
+			NumErrors--;
+		}
+		else
+		{
+			NumWarnings--;
+		}
 
-			TArray<TSharedPtr<FJsonValue>> RuleViolationJsonObjects;
+		if (!Violation->SuggestedName.IsEmpty())
+		{
+			NumSuggestedRenames--;
+		}
 
-			for (TSharedPtr<FLintRuleViolation> Violation : UniqueViolatorViolations)
+		if (TSharedPtr<FLintReportRuleItem>* RuleItem = RuleItemsByRule.Find(LintRule))
+		{
+			// Children and RuleViolations are always added and removed together, so they share the removed node's index
+			const int32 ChildIndex = AssetItem->ViolationItems[ViolationIndex]->ChildIndex;
+			(*RuleItem)->RuleViolations.RemoveAtSwap(ChildIndex);
+			(*RuleItem)->Children.RemoveAtSwap(ChildIndex);
+			if ((*RuleItem)->Children.IsValidIndex(ChildIndex))
 			{
-				ULintRule* LintRule = Violation->ViolatedRule->GetDefaultObject<ULintRule>();
-				check(LintRule != nullptr);
-
-				TSharedPtr<FJsonObject> RuleJsonObject = MakeShareable(new FJsonObject);
-				RuleJsonObject->SetStringField(TEXT("RuleGroup"), LintRule->RuleGroup.ToString());
-				RuleJsonObject->SetStringField(TEXT("RuleTitle"), LintRule->RuleTitle.ToString());
-				RuleJsonObject->SetStringField(TEXT("RuleDesc"), LintRule->RuleDescription.ToString());
-				RuleJsonObject->SetStringField(TEXT("RuleURL"), LintRule->RuleURL);
-				RuleJsonObject->SetNumberField(TEXT("RuleSeverity"), (int32)LintRule->RuleSeverity);
-				RuleJsonObject->SetStringField(TEXT("RuleRecommendedAction"), Violation->RecommendedAction.ToString());
-				RuleViolationJsonObjects.Push(MakeShareable(new FJsonValueObject(RuleJsonObject)));
+				(*RuleItem)->Children[ChildIndex]->ChildIndex = ChildIndex;
 			}
 
-			AssetJsonObject->SetArrayField(TEXT("Violations"), RuleViolationJsonObjects);
+			if ((*RuleItem)->RuleViolations.Num() == 0)
+			{
+				RuleItems.Remove(*RuleItem);
+				RuleItemsByRule.Remove(LintRule);
+			}
 		}
 
-		ViolatorJsonObjects.Add(MakeShareable(new FJsonValueObject(AssetJsonObject)));
+		RuleViolations.Remove(Violation);
+	}
 
-		AssetDetailsScrollBoxPtr.Get()->AddSlot()
-		.HAlign(HAlign_Fill)
-		.VAlign(VAlign_Fill)
+	for (const int32 SearchId : AssetItem->SearchIds)
+	{
+		SearchIndex.Remove(SearchId);
+	}
+
+	bExportsDirty = true;
+	bFilterDirty = true;
+}
+
+void SLintReport::ApplyFilter()
+{
+	bFilterDirty = false;
+
+	if (SearchQuery.IsEmpty())
+	{
+		SearchMatches.Empty();
+		FilteredAssetItems = AssetItems;
+		FilteredRuleItems = RuleItems;
+	}
+	else
+	{
+		SearchMatches = SearchIndex.Search(SearchQuery);
+
+		FilteredAssetItems.Reset();
+		for (const TSharedPtr<FLintReportAssetItem>& AssetItem : AssetItems)
+		{
+			if (AssetItem->SearchIds.ContainsByPredicate([this](int32 SearchId) { return SearchMatches[SearchId]; }))
+			{
+				FilteredAssetItems.Add(AssetItem);
+			}
+		}
+
+		FilteredRuleItems.Reset();
+		for (const TSharedPtr<FLintReportRuleItem>& RuleItem : RuleItems)
+		{
+			if (RuleItem->Children.ContainsByPredicate([this](const TSharedPtr<FLintReportRuleItem>& Child) { return SearchMatches[Child->SearchId]; }))
+			{
+				FilteredRuleItems.Add(RuleItem);
+			}
+		}
+	}
+
+	AssetDetailsListViewPtr->RequestListRefresh();
+	RuleDetailsTreeViewPtr->RequestTreeRefresh();
+}
+
+void SLintReport::OnSearchTextChanged(const FText& SearchText)
+{
+	SearchQuery = FLintReportSearchIndex::FQuery::Parse(SearchText.ToString());
+	ApplyFilter();
+}
+
+TSharedRef<ITableRow> SLintReport::OnGenerateAssetRow(TSharedPtr<FLintReportAssetItem> InItem, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	const float PaddingAmount = FLinterStyle::Get()->GetFloat("Linter.Padding");
+
+	return SNew(STableRow<TSharedPtr<FLintReportAssetItem>>, OwnerTable)
 		.Padding(PaddingAmount)
 		[
 			SNew(SLintReportAssetDetails)
-			.AssetData(AssetData)
-			.RuleViolations(UniqueViolatorViolations)
+			.AssetData(InItem->AssetData)
+			.RuleViolations(InItem->RuleViolations)
 			.ThumbnailPool(ThumbnailPool)
+			.ThumbnailCache(ThumbnailCache)
+			.OnRelint(FSimpleDelegate::CreateSP(this, &SLintReport::RelintAsset, InItem->AssetData))
 		];
+}
+
+TSharedRef<ITableRow> SLintReport::OnGenerateRuleRow(TSharedPtr<FLintReportRuleItem> InItem, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	const float PaddingAmount = FLinterStyle::Get()->GetFloat("Linter.Padding");
+
+	if (InItem->RuleViolation.IsValid())
+	{
+		return SNew(STableRow<TSharedPtr<FLintReportRuleItem>>, OwnerTable)
+			[
+				SNew(SLintReportRuleError)
+				.RuleViolation(InItem->RuleViolation)
+			];
 	}
 
-	TMultiMap<const ULintRule*, TSharedPtr<FLintRuleViolation>> ViolationsMappedByRule = FLintRuleViolation::AllRuleViolationsMappedByViolatedLintRuleShared(RuleViolations);
-	TSharedPtr<FAssetThumbnailPool> RuleThumbnailPool = MakeShareable(new FAssetThumbnailPool(ViolationsMappedByRule.Num())); // Incase we ever want to render 'rule thumbnails' in the future
+	return SNew(STableRow<TSharedPtr<FLintReportRuleItem>>, OwnerTable)
+		.Padding(PaddingAmount)
+		[
+			SNew(SLintReportRuleDetails)
+			.RuleViolations(InItem->RuleViolations)
+			.ThumbnailPool(RuleThumbnailPool)
+		];
+}
 
-	TArray<const ULintRule*> UniqueRules;
-	ViolationsMappedByRule.GetKeys(UniqueRules);
+void SLintReport::OnGetRuleChildren(TSharedPtr<FLintReportRuleItem> InItem, TArray<TSharedPtr<FLintReportRuleItem>>& OutChildren)
+{
+	if (SearchQuery.IsEmpty())
+	{
+		OutChildren = InItem->Children;
+		return;
+	}
 
-	for (const ULintRule* BrokenRule : UniqueRules)
+	for (const TSharedPtr<FLintReportRuleItem>& Child : InItem->Children)
 	{
-		TArray<TSharedPtr<FLintRuleViolation>> ViolatorsOfBrokenRule;
-		ViolationsMappedByRule.MultiFind(BrokenRule, ViolatorsOfBrokenRule);
+		// Children may have been added since the last search, those are picked up by the next one
+		if (SearchMatches.IsValidIndex(Child->SearchId) && SearchMatches[Child->SearchId])
+		{
+			OutChildren.Add(Child);
+		}
+	}
+}
 
-		if (ViolatorsOfBrokenRule.Num() > 0)
+FText SLintReport::GetResultsSummary() const
+{
+	FText ResultsSummary = FText::FormatNamed(LOCTEXT("ErrorWarningDisplay", "{NumAssets} {NumAssets}|plural(one=Asset,other=Assets), {NumErrors} {NumErrors}|plural(one=Error,other=Errors), {NumWarnings} {NumWarnings}|plural(one=Warning,other=Warnings)"), TEXT("NumAssets"), AssetItems.Num(), TEXT("NumErrors"), NumErrors, TEXT("NumWarnings"), NumWarnings);
+	if (LintJob.IsValid())
+	{
+		ResultsSummary = FText::Format(LOCTEXT("LintingProgressDisplay", "Linting {0}/{1} assets... {2}"), LintJob->GetNumAssetsCompleted(), LintJob->GetNumAssets(), ResultsSummary);
+	}
+	else if (bWasCancelled)
+	{
+		ResultsSummary = FText::Format(LOCTEXT("CancelledResultsDisplay", "{0} (Cancelled, partial results)"), ResultsSummary);
+	}
+	return ResultsSummary;
+}
+
+void SLintReport::FinishReport(bool bJobWasCancelled)
+{
+	// Rebuild clears this, so a re-lint finishing after a cancelled full lint doesn't hide that the report is partial
+	bWasCancelled = bWasCancelled || bJobWasCancelled;
+
+	// Rule rows were generated while their violation counts were still growing
+	RuleDetailsTreeViewPtr->RebuildList();
+	ResultsTextBlockPtr->SetText(GetResultsSummary());
+
+	bHasRanReport = true;
+}
+
+void SLintReport::UpdateExports()
+{
+	if (!bExportsDirty)
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> RootJsonObject = MakeShareable(new FJsonObject);
+	TArray<TSharedPtr<FJsonValue>> ViolatorJsonObjects;
+
+	for (const TSharedPtr<FLintReportAssetItem>& AssetItem : AssetItems)
+	{
+		TSharedPtr<FJsonObject> AssetJsonObject = MakeShareable(new FJsonObject);
+		const FAssetData& AssetData = AssetItem->AssetData;
+		AssetJsonObject->SetStringField(TEXT("ViolatorAssetName"), AssetData.AssetName.ToString());
+		AssetJsonObject->SetStringField(TEXT("ViolatorAssetPath"), AssetData.ObjectPath.ToString());
+		AssetJsonObject->SetStringField(TEXT("ViolatorFullName"), AssetData.GetFullName());
+		//@TODO: Thumbnail export?
+
+		TArray<TSharedPtr<FJsonValue>> RuleViolationJsonObjects;
+
+		for (TSharedPtr<FLintRuleViolation> Violation : AssetItem->RuleViolations)
 		{
-			RuleDetailsScrollBoxPtr.Get()->AddSlot()
-			.HAlign(HAlign_Fill)
-			.VAlign(VAlign_Fill)
-			.Padding(PaddingAmount)
-			[
-				SNew(SLintReportRuleDetails)
-				.RuleViolations(ViolatorsOfBrokenRule)
-				.ThumbnailPool(RuleThumbnailPool)
-			];
+			ULintRule* LintRule = Violation->ViolatedRule->GetDefaultObject<ULintRule>();
+			check(LintRule != nullptr);
+
+			TSharedPtr<FJsonObject> RuleJsonObject = MakeShareable(new FJsonObject);
+			RuleJsonObject->SetStringField(TEXT("RuleGroup"), LintRule->RuleGroup.ToString());
+			RuleJsonObject->SetStringField(TEXT("RuleTitle"), LintRule->RuleTitle.ToString());
+			RuleJsonObject->SetStringField(TEXT("RuleDesc"), LintRule->RuleDescription.ToString());
+			RuleJsonObject->SetStringField(TEXT("RuleURL"), LintRule->RuleURL);
+			RuleJsonObject->SetNumberField(TEXT("RuleSeverity"), (int32)LintRule->RuleSeverity);
+			RuleJsonObject->SetStringField(TEXT("RuleRecommendedAction"), Violation->RecommendedAction.ToString());
+			if (!Violation->RuleSetName.IsNone())
+			{
+				RuleJsonObject->SetStringField(TEXT("RuleSet"), Violation->RuleSetName.ToString());
+			}
+			RuleViolationJsonObjects.Push(MakeShareable(new FJsonValueObject(RuleJsonObject)));
 		}
+
+		AssetJsonObject->SetArrayField(TEXT("Violations"), RuleViolationJsonObjects);
+		ViolatorJsonObjects.Add(MakeShareable(new FJsonValueObject(AssetJsonObject)));
 	}
 
 	// Save off our JSON to a string
@@ -348,10 +831,7 @@ void SLintReport::Rebuild(const ULintRuleSet* SelectedLintRuleSet)
 	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonReport);
 	FJsonSerializer::Serialize(RootJsonObject.ToSharedRef(), Writer);
 
-	// Update Summary Text Block
-	int32 NumAssets = UniqueViolators.Num();
-	FText ResultsSummary = FText::FormatNamed(LOCTEXT("ErrorWarningDisplay", "{NumAssets} {NumAssets}|plural(one=Asset,other=Assets), {NumErrors} {NumErrors}|plural(one=Error,other=Errors), {NumWarnings} {NumWarnings}|plural(one=Warning,other=Warnings)"), TEXT("NumAssets"), NumAssets, TEXT("NumErrors"), NumErrors, TEXT("NumWarnings"), NumWarnings);
-	ResultsTextBlockPtr->SetText(ResultsSummary);
+	const FText ResultsSummary = GetResultsSummary();
 
 	// Prepare the HTML Export
 	FString TemplatePath = FPaths::Combine(*IPluginManager::Get().FindPlugin(TEXT("Linter"))->GetBaseDir(), TEXT("Resources"), TEXT("LintReportTemplate.html"));
@@ -363,7 +843,7 @@ void SLintReport::Rebuild(const ULintRuleSet* SelectedLintRuleSet)
 		HTMLReport.ReplaceInline(TEXT("{% LINT_REPORT %}"), *JsonReport);
 	}
 
-	bHasRanReport = true;
+	bExportsDirty = false;
 }
 
 TSharedRef<SWidget> SLintReport::GetViewButtonContent()
@@ -379,17 +859,17 @@ TSharedRef<SWidget> SLintReport::GetViewButtonContent()
 			FUIAction(
 				FExecuteAction::CreateLambda([&]()
 				{ 
-					if (AssetDetailsScrollBoxPtr.IsValid())
+					if (AssetDetailsListViewPtr.IsValid())
 					{
-						AssetDetailsScrollBoxPtr->SetVisibility(EVisibility::SelfHitTestInvisible);
+						AssetDetailsListViewPtr->SetVisibility(EVisibility::Visible);
 					}
-					if (RuleDetailsScrollBoxPtr.IsValid())
+					if (RuleDetailsTreeViewPtr.IsValid())
 					{
-						RuleDetailsScrollBoxPtr->SetVisibility(EVisibility::Collapsed);
+						RuleDetailsTreeViewPtr->SetVisibility(EVisibility::Collapsed);
 					}
 				}),
 				FCanExecuteAction(),
-				FIsActionChecked::CreateLambda([&]() { return AssetDetailsScrollBoxPtr.IsValid() && AssetDetailsScrollBoxPtr->GetVisibility().IsVisible(); })
+				FIsActionChecked::CreateLambda([&]() { return AssetDetailsListViewPtr.IsValid() && AssetDetailsListViewPtr->GetVisibility().IsVisible(); })
 			),
 			NAME_None,
 			EUserInterfaceActionType::RadioButton
@@ -402,17 +882,17 @@ TSharedRef<SWidget> SLintReport::GetViewButtonContent()
 			FUIAction(
 				FExecuteAction::CreateLambda([&]()
 				{ 
-					if (AssetDetailsScrollBoxPtr.IsValid())
+					if (AssetDetailsListViewPtr.IsValid())
 					{
-						AssetDetailsScrollBoxPtr->SetVisibility(EVisibility::Collapsed);
+						AssetDetailsListViewPtr->SetVisibility(EVisibility::Collapsed);
 					}
-					if (RuleDetailsScrollBoxPtr.IsValid())
+					if (RuleDetailsTreeViewPtr.IsValid())
 					{
-						RuleDetailsScrollBoxPtr->SetVisibility(EVisibility::SelfHitTestInvisible);
+						RuleDetailsTreeViewPtr->SetVisibility(EVisibility::Visible);
 					}
 				}),
 				FCanExecuteAction(),
-				FIsActionChecked::CreateLambda([&]() { return RuleDetailsScrollBoxPtr.IsValid() && RuleDetailsScrollBoxPtr->GetVisibility().IsVisible(); })
+				FIsActionChecked::CreateLambda([&]() { return RuleDetailsTreeViewPtr.IsValid() && RuleDetailsTreeViewPtr->GetVisibility().IsVisible(); })
 			),
 			NAME_None,
 			EUserInterfaceActionType::RadioButton
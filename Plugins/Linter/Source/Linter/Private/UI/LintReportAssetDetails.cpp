@@ -19,6 +19,10 @@
 #include "UI/LintReportAssetError.h"
 #include "LintRule.h"
 #include "AssetThumbnail.h"
+#include "Brushes/SlateDynamicImageBrush.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Input/SButton.h"
+#include "UI/LintReportThumbnailCache.h"
 
 
 #define LOCTEXT_NAMESPACE "LintReport"
@@ -34,7 +38,22 @@ void SLintReportAssetDetails::Construct(const FArguments& Args)
 	FText AssetName = FText::FromString(AssetData.Get().AssetName.ToString());
 	FText AssetPath = FText::FromString(AssetData.Get().GetFullName());
 
-	const TSharedPtr<FAssetThumbnail> AssetThumbnail = MakeShareable(new FAssetThumbnail(AssetData.Get().GetAsset(), 96, 96, ThumbnailPool.Get()));
+	// Use the thumbnail saved in the package when there is one, and only fall back to the pool (which may render) when there isn't
+	TSharedPtr<SWidget> ThumbnailWidget;
+	if (Args._ThumbnailCache.IsValid())
+	{
+		CachedThumbnailBrush = Args._ThumbnailCache->FindOrLoad(AssetData.Get());
+	}
+
+	if (CachedThumbnailBrush.IsValid())
+	{
+		ThumbnailWidget = SNew(SImage).Image(CachedThumbnailBrush.Get());
+	}
+	else
+	{
+		const TSharedPtr<FAssetThumbnail> AssetThumbnail = MakeShareable(new FAssetThumbnail(AssetData.Get(), 96, 96, ThumbnailPool.Get()));
+		ThumbnailWidget = AssetThumbnail->MakeThumbnailWidget();
+	}
 
 	int32 NumErrors = 0;
 	int32 NumWarnings = 0;
@@ -84,6 +103,16 @@ void SLintReportAssetDetails::Construct(const FArguments& Args)
 							.Text(AssetName)
 							.TextStyle(FLinterStyle::Get(), "Linter.Report.AssetName")
 						]
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.Padding(8.0f, 0.0f)
+						[
+							SNew(SButton)
+							.Text(LOCTEXT("RelintAsset", "Re-lint"))
+							.ToolTipText(LOCTEXT("RelintAssetTooltip", "Lint this asset again and update the report."))
+							.Visibility(Args._OnRelint.IsBound() ? EVisibility::Visible : EVisibility::Collapsed)
+							.OnClicked_Lambda([OnRelint = Args._OnRelint]() -> FReply { OnRelint.ExecuteIfBound(); return FReply::Handled(); })
+						]
 					]
 					.BodyContent()
 					[
@@ -97,7 +126,7 @@ void SLintReportAssetDetails::Construct(const FArguments& Args)
 							.WidthOverride(96.0f)
 							.HeightOverride(96.0f)
 							[
-								AssetThumbnail->MakeThumbnailWidget()
+								ThumbnailWidget.ToSharedRef()
 							]
 						]
 						+ SHorizontalBox::Slot()
@@ -16,7 +16,6 @@
 #include "Internationalization/Internationalization.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Framework/Views/ITypedTableView.h"
-#include "UI/LintReportRuleErrorList.h"
 #include "LintRule.h"
 #include "AssetThumbnail.h"
 
@@ -185,14 +184,6 @@ void SLintReportRuleDetails::Construct(const FArguments& Args)
 							.AutoWrapText(true)
 							.TextStyle(FLinterStyle::Get(), "Linter.Report.AssetName")
 						]
-						+ SVerticalBox::Slot()
-						.Padding(PaddingAmount)
-						.HAlign(HAlign_Left)
-						.AutoHeight()
-						[
-							SNew(SLintReportRuleErrorList)
-							.RuleViolations(RuleViolations)
-						]
 					]
 				]
 			]
@@ -0,0 +1,273 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#include "UI/LintReportSearchIndex.h"
+#include "Algo/BinarySearch.h"
+
+FLintReportSearchIndex::FQuery FLintReportSearchIndex::FQuery::Parse(const FString& SearchText)
+{
+	FQuery Query;
+
+	TArray<FString> Terms;
+	SearchText.ParseIntoArrayWS(Terms);
+
+	for (const FString& Term : Terms)
+	{
+		FString Key;
+		FString Value;
+		if (!Term.Split(TEXT(":"), &Key, &Value) || Value.IsEmpty())
+		{
+			Tokenize(Term, Query.TextTokens);
+			continue;
+		}
+
+		if (Key.Equals(TEXT("severity"), ESearchCase::IgnoreCase))
+		{
+			if (Value.StartsWith(TEXT("e"), ESearchCase::IgnoreCase))
+			{
+				Query.MaxSeverity = ELintRuleSeverity::Error;
+			}
+			else if (Value.StartsWith(TEXT("w"), ESearchCase::IgnoreCase))
+			{
+				Query.MaxSeverity = ELintRuleSeverity::Warning;
+			}
+			else if (Value.StartsWith(TEXT("i"), ESearchCase::IgnoreCase))
+			{
+				Query.MaxSeverity = ELintRuleSeverity::Info;
+			}
+		}
+		else if (Key.Equals(TEXT("group"), ESearchCase::IgnoreCase))
+		{
+			Query.RuleGroup = FName(*Value);
+		}
+		else if (Key.Equals(TEXT("class"), ESearchCase::IgnoreCase))
+		{
+			Query.AssetClass = FName(*Value);
+		}
+		else if (Key.Equals(TEXT("path"), ESearchCase::IgnoreCase))
+		{
+			Query.PathPrefix = Value;
+		}
+		else
+		{
+			Tokenize(Term, Query.TextTokens);
+		}
+	}
+
+	return Query;
+}
+
+int32 FLintReportSearchIndex::Add(const TSharedPtr<FLintRuleViolation>& Violation)
+{
+	const int32 Id = Entries.Add(Violation);
+	LiveEntries.Add(true);
+
+	const ULintRule* LintRule = Violation->ViolatedRule->GetDefaultObject<ULintRule>();
+	SeverityPostings[FMath::Clamp((int32)LintRule->RuleSeverity, 0, (int32)UE_ARRAY_COUNT(SeverityPostings) - 1)].Add(Id);
+	RuleGroupPostings.FindOrAdd(LintRule->RuleGroup).Add(Id);
+	AssetClassPostings.FindOrAdd(Violation->ViolatorAssetData.AssetClass).Add(Id);
+
+	TArray<FString> Tokens;
+	Tokenize(LintRule->RuleTitle.ToString(), Tokens);
+	Tokenize(Violation->RecommendedAction.ToString(), Tokens);
+	Tokenize(Violation->ViolatorAssetData.AssetName.ToString(), Tokens);
+	for (const FString& Token : TSet<FString>(Tokens))
+	{
+		TArray<int32>* Postings = TokenPostings.Find(Token);
+		if (Postings == nullptr)
+		{
+			Postings = &TokenPostings.Add(Token);
+			bSortedTokensDirty = true;
+		}
+		Postings->Add(Id);
+	}
+
+	if (PathNodes.Num() == 0)
+	{
+		PathNodes.AddDefaulted();
+	}
+
+	TArray<FString> PathSegments;
+	Violation->ViolatorAssetData.PackagePath.ToString().ParseIntoArray(PathSegments, TEXT("/"));
+	int32 NodeIndex = 0;
+	for (const FString& Segment : PathSegments)
+	{
+		const FName SegmentName(*Segment);
+		int32* ChildIndex = PathNodes[NodeIndex].Children.Find(SegmentName);
+		if (ChildIndex == nullptr)
+		{
+			const int32 NewNodeIndex = PathNodes.AddDefaulted();
+			PathNodes[NodeIndex].Children.Add(SegmentName, NewNodeIndex);
+			NodeIndex = NewNodeIndex;
+		}
+		else
+		{
+			NodeIndex = *ChildIndex;
+		}
+	}
+	PathNodes[NodeIndex].Postings.Add(Id);
+
+	return Id;
+}
+
+void FLintReportSearchIndex::Remove(int32 Id)
+{
+	// Postings keep the id, it's just never reported again
+	if (Entries.IsValidIndex(Id))
+	{
+		Entries[Id].Reset();
+		LiveEntries[Id] = false;
+	}
+}
+
+void FLintReportSearchIndex::Reset()
+{
+	Entries.Reset();
+	LiveEntries.Empty();
+	for (TArray<int32>& Postings : SeverityPostings)
+	{
+		Postings.Reset();
+	}
+	RuleGroupPostings.Reset();
+	AssetClassPostings.Reset();
+	TokenPostings.Reset();
+	SortedTokens.Reset();
+	bSortedTokensDirty = false;
+	PathNodes.Reset();
+}
+
+TBitArray<> FLintReportSearchIndex::Search(const FQuery& Query) const
+{
+	TBitArray<> Matches = LiveEntries;
+
+	if (Query.MaxSeverity.IsSet())
+	{
+		TBitArray<> SeverityMatches(false, Entries.Num());
+		for (int32 Severity = 0; Severity <= (int32)Query.MaxSeverity.GetValue() && Severity < (int32)UE_ARRAY_COUNT(SeverityPostings); ++Severity)
+		{
+			SetBits(SeverityMatches, SeverityPostings[Severity]);
+		}
+		AndBits(Matches, SeverityMatches);
+	}
+
+	if (!Query.RuleGroup.IsNone())
+	{
+		TBitArray<> GroupMatches(false, Entries.Num());
+		if (const TArray<int32>* Postings = RuleGroupPostings.Find(Query.RuleGroup))
+		{
+			SetBits(GroupMatches, *Postings);
+		}
+		AndBits(Matches, GroupMatches);
+	}
+
+	if (!Query.AssetClass.IsNone())
+	{
+		TBitArray<> ClassMatches(false, Entries.Num());
+		if (const TArray<int32>* Postings = AssetClassPostings.Find(Query.AssetClass))
+		{
+			SetBits(ClassMatches, *Postings);
+		}
+		AndBits(Matches, ClassMatches);
+	}
+
+	if (!Query.PathPrefix.IsEmpty())
+	{
+		TBitArray<> PathMatches(false, Entries.Num());
+
+		TArray<FString> PathSegments;
+		Query.PathPrefix.ParseIntoArray(PathSegments, TEXT("/"));
+		int32 NodeIndex = PathNodes.Num() > 0 ? 0 : INDEX_NONE;
+		for (int32 SegmentIndex = 0; SegmentIndex < PathSegments.Num() && NodeIndex != INDEX_NONE; ++SegmentIndex)
+		{
+			const int32* ChildIndex = PathNodes[NodeIndex].Children.Find(FName(*PathSegments[SegmentIndex]));
+			NodeIndex = ChildIndex != nullptr ? *ChildIndex : INDEX_NONE;
+		}
+
+		if (NodeIndex != INDEX_NONE)
+		{
+			SetPathBits(PathMatches, NodeIndex);
+		}
+		AndBits(Matches, PathMatches);
+	}
+
+	// Every search term has to match, and each term matches any indexed token it is a prefix of so results update while typing
+	if (Query.TextTokens.Num() > 0)
+	{
+		SortTokens();
+	}
+
+	for (const FString& QueryToken : Query.TextTokens)
+	{
+		TBitArray<> TokenMatches(false, Entries.Num());
+		for (int32 TokenIndex = Algo::LowerBound(SortedTokens, QueryToken, &FLintReportSearchIndex::TokenLess);
+			TokenIndex < SortedTokens.Num() && SortedTokens[TokenIndex].StartsWith(QueryToken, ESearchCase::CaseSensitive); ++TokenIndex)
+		{
+			SetBits(TokenMatches, TokenPostings.FindChecked(SortedTokens[TokenIndex]));
+		}
+		AndBits(Matches, TokenMatches);
+	}
+
+	return Matches;
+}
+
+void FLintReportSearchIndex::Tokenize(const FString& Text, TArray<FString>& OutTokens)
+{
+	FString Token;
+	for (const TCHAR Character : Text)
+	{
+		if (FChar::IsAlnum(Character))
+		{
+			Token.AppendChar(FChar::ToLower(Character));
+		}
+		else if (Token.Len() > 0)
+		{
+			OutTokens.Add(MoveTemp(Token));
+			Token.Reset();
+		}
+	}
+
+	if (Token.Len() > 0)
+	{
+		OutTokens.Add(MoveTemp(Token));
+	}
+}
+
+void FLintReportSearchIndex::SetBits(TBitArray<>& Bits, const TArray<int32>& Postings)
+{
+	for (const int32 Id : Postings)
+	{
+		Bits[Id] = true;
+	}
+}
+
+void FLintReportSearchIndex::AndBits(TBitArray<>& Bits, const TBitArray<>& Other)
+{
+	check(Bits.Num() == Other.Num());
+
+	uint32* Words = Bits.GetData();
+	const uint32* OtherWords = Other.GetData();
+	const int32 NumWords = FMath::DivideAndRoundUp(Bits.Num(), NumBitsPerDWORD);
+	for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+	{
+		Words[WordIndex] &= OtherWords[WordIndex];
+	}
+}
+
+void FLintReportSearchIndex::SetPathBits(TBitArray<>& Bits, int32 NodeIndex) const
+{
+	const FPathNode& Node = PathNodes[NodeIndex];
+	SetBits(Bits, Node.Postings);
+	for (const TPair<FName, int32>& Child : Node.Children)
+	{
+		SetPathBits(Bits, Child.Value);
+	}
+}
+
+void FLintReportSearchIndex::SortTokens() const
+{
+	// Sorting once per batch of new tokens keeps adding violations linear, where keeping the array sorted on every add was quadratic
+	if (bSortedTokensDirty)
+	{
+		TokenPostings.GenerateKeyArray(SortedTokens);
+		SortedTokens.Sort(&FLintReportSearchIndex::TokenLess);
+		bSortedTokensDirty = false;
+	}
+}
@@ -0,0 +1,50 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#include "UI/LintReportThumbnailCache.h"
+#include "Brushes/SlateDynamicImageBrush.h"
+#include "Misc/ObjectThumbnail.h"
+#include "Misc/PackageName.h"
+#include "ObjectTools.h"
+
+FLintReportThumbnailCache::FLintReportThumbnailCache(int32 InMaxNumThumbnails)
+	: Thumbnails(InMaxNumThumbnails)
+{
+}
+
+TSharedPtr<FSlateDynamicImageBrush> FLintReportThumbnailCache::FindOrLoad(const FAssetData& AssetData)
+{
+	if (const TSharedPtr<FSlateDynamicImageBrush>* CachedBrush = Thumbnails.FindAndTouch(AssetData.ObjectPath))
+	{
+		return *CachedBrush;
+	}
+
+	const FName ObjectFullName = FName(*AssetData.GetFullName());
+
+	// Prefer thumbnails that are already in memory, otherwise read only the thumbnail table of the package from disk
+	FObjectThumbnail* ObjectThumbnail = ThumbnailTools::FindCachedThumbnail(ObjectFullName.ToString());
+
+	FThumbnailMap LoadedThumbnails;
+	FString PackageFilename;
+	if (ObjectThumbnail == nullptr && FPackageName::DoesPackageExist(AssetData.PackageName.ToString(), nullptr, &PackageFilename))
+	{
+		TSet<FName> ObjectFullNames;
+		ObjectFullNames.Add(ObjectFullName);
+		if (ThumbnailTools::LoadThumbnailsFromPackage(PackageFilename, ObjectFullNames, LoadedThumbnails))
+		{
+			ObjectThumbnail = LoadedThumbnails.Find(ObjectFullName);
+		}
+	}
+
+	TSharedPtr<FSlateDynamicImageBrush> Brush;
+	if (ObjectThumbnail != nullptr && !ObjectThumbnail->IsEmpty())
+	{
+		const TArray<uint8>& ImageData = ObjectThumbnail->GetUncompressedImageData();
+		if (ImageData.Num() > 0)
+		{
+			const FName ResourceName = FName(*FString::Printf(TEXT("LintReportThumbnail_%s_%d"), *AssetData.ObjectPath.ToString(), NextResourceId++));
+			Brush = FSlateDynamicImageBrush::CreateWithImageData(ResourceName, FVector2D(ObjectThumbnail->GetImageWidth(), ObjectThumbnail->GetImageHeight()), ImageData);
+		}
+	}
+
+	Thumbnails.Add(AssetData.ObjectPath, Brush);
+	return Brush;
+}
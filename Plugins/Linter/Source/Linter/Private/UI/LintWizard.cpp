@@ -8,6 +8,7 @@
 #include "AssetData.h"
 #include "SlateOptMacros.h"
 #include "Widgets/Layout/SSeparator.h"
+#include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Views/SListView.h"
 #include "Widgets/Text/SRichTextBlock.h"
 #include "Widgets/Notifications/SNotificationList.h"
@@ -24,6 +25,7 @@
 #include "LintRuleSet.h"
 #include "LinterSettings.h"
 #include "UI/SAssetLinkWidget.h"
+#include "LintRedirectorFixer.h"
 
 
 
@@ -35,36 +37,27 @@ void SLintWizard::Construct(const FArguments& InArgs)
 
 	RuleSets = TArray<TSharedPtr<FAssetData>>();
 
-	// Try to load the default rule set
-	ULintRuleSet* DefaultRuleSet = GetDefault<ULinterSettings>()->DefaultLintRuleSet.LoadSynchronous();
+	// Rule sets are listed from the asset registry alone, the selected ones are only loaded once the lint report is entered
+	const FName DefaultRuleSetPath = GetDefault<ULinterSettings>()->DefaultLintRuleSet.ToSoftObjectPath().GetAssetPathName();
 
-	// Even though this happens on module startup, we try force loading all rule sets again in case any new unloaded rule sets have been added
-	// or for some reason our existing rule sets were unloaded from memory
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(FName("AssetRegistry"));
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
 	TArray<FAssetData> FoundRuleSets;
 	AssetRegistry.GetAssetsByClass(ULintRuleSet::StaticClass()->GetFName(), FoundRuleSets, true);
 
-	// Attempt to get all RuleSets in memory so that linting tools are better aware of them
 	for (const FAssetData& RuleSetData : FoundRuleSets)
 	{
-		ULintRuleSet* LoadedRuleSet = Cast<ULintRuleSet>(RuleSetData.GetAsset());
-		if (LoadedRuleSet != nullptr)
+		RuleSets.Push(MakeShareable(new FAssetData(RuleSetData)));
+		if (RuleSetData.ObjectPath == DefaultRuleSetPath)
 		{
-			FAssetData* newData = new FAssetData;
-			*newData = RuleSetData;
-			RuleSets.Push(MakeShareable(newData));
-			if (LoadedRuleSet == DefaultRuleSet)
-			{
-				SelectedRuleSet = RuleSets.Last();
-			}
+			SelectedRuleSets.Add(RuleSets.Last());
 		}
 	}
 
-	if (!SelectedRuleSet.IsValid() && RuleSets.Num() > 0)
+	if (SelectedRuleSets.Num() == 0 && RuleSets.Num() > 0)
 	{
-		SelectedRuleSet = RuleSets[0];
+		SelectedRuleSets.Add(RuleSets[0]);
 	}
 
 	ChildSlot
@@ -115,30 +108,46 @@ void SLintWizard::Construct(const FArguments& InArgs)
 					.AutoHeight()
 					.Padding(PaddingAmount)
 					[
-						SAssignNew(RuleSetSelectionComboBox, SComboBox<TSharedPtr<FAssetData>>)
-						.OptionsSource(&RuleSets)
-						.InitiallySelectedItem(SelectedRuleSet)
-						.OnGenerateWidget_Lambda([&](TSharedPtr<FAssetData> LintRuleSet)
-						{ 
-							ULintRuleSet* RuleSet = Cast<ULintRuleSet>(LintRuleSet->GetAsset());
-							if (RuleSet != nullptr)
-							{
-								return SNew(STextBlock).Text(RuleSet->RuleSetDescription.IsEmpty() ? FText::FromString(RuleSet->GetPathName()) : RuleSet->RuleSetDescription);
-							}
-							return SNew(STextBlock).Text(FText::FromString(TEXT("This Lint Rule Set Failed To Load? Uhhhh....")));							
+						SAssignNew(RuleSetSelectionListView, SListView<TSharedPtr<FAssetData>>)
+						.ListItemsSource(&RuleSets)
+						.SelectionMode(ESelectionMode::None)
+						.OnGenerateRow_Lambda([&](TSharedPtr<FAssetData> LintRuleSet, const TSharedRef<STableViewBase>& OwnerTable)
+						{
+							return SNew(STableRow<TSharedPtr<FAssetData>>, OwnerTable)
+							.Padding(4.0f)
+							[
+								SNew(SCheckBox)
+								.IsChecked_Lambda([this, LintRuleSet]() { return SelectedRuleSets.Contains(LintRuleSet) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+								.OnCheckStateChanged_Lambda([this, LintRuleSet](ECheckBoxState NewState)
+								{
+									if (NewState == ECheckBoxState::Checked)
+									{
+										SelectedRuleSets.AddUnique(LintRuleSet);
+									}
+									else
+									{
+										SelectedRuleSets.Remove(LintRuleSet);
+									}
+								})
+								[
+									SNew(STextBlock).Text(GetRuleSetDescription(*LintRuleSet))
+								]
+							];
 						})
-						.OnSelectionChanged_Lambda([&](TSharedPtr<FAssetData> Item, ESelectInfo::Type SelectInfo) { SelectedRuleSet = Item; RuleSetSelectionComboBox->RefreshOptions(); })
-						.ContentPadding(4.0f)
-						[
-							SNew(STextBlock)
-							.Text_Lambda([&]() { return SelectedRuleSet->GetAsset() != nullptr ? Cast<ULintRuleSet>(SelectedRuleSet->GetAsset())->RuleSetDescription : FText::GetEmpty(); })
-						]
+					]
+					+SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(PaddingAmount)
+					[
+						SNew(STextBlock)
+						.AutoWrapText(true)
+						.Text(LOCTEXT("LinterSelectionMultipleHint", "Checking more than one rule set lints with all of them in a single pass, loading each asset only once."))
 					]
 				]
 				// Lint Report
 				+ SWizard::Page()
 				.OnEnter(this, &SLintWizard::OnLintReportEntered)
-				.CanShow_Lambda([&]() { return RuleSets.Num() >= 1 && SelectedRuleSet.IsValid(); })
+				.CanShow_Lambda([&]() { return RuleSets.Num() >= 1 && SelectedRuleSets.Num() > 0; })
 				[
 					SNew(SVerticalBox)
 					// Title
@@ -157,7 +166,7 @@ void SLintWizard::Construct(const FArguments& InArgs)
 					[
 						SNew(STextBlock)
 						.Text(LOCTEXT("MarketplaceNoErrorsRequired", "The Epic Marketplace requires you to have zero linting errors before submission and approval."))
-						.Visibility_Lambda([&]() { return (LintReport.IsValid() && LintReport->bHasRanReport && LintReport->NumErrors > 0 && LintReport->LastUsedRuleSet != nullptr && LintReport->LastUsedRuleSet->bShowMarketplacePublishingInfoInLintWizard) ? EVisibility::HitTestInvisible : EVisibility::Collapsed; })
+						.Visibility_Lambda([&]() { return (LintReport.IsValid() && LintReport->bHasRanReport && LintReport->NumErrors > 0 && LintReport->ShowsMarketplacePublishingInfo()) ? EVisibility::HitTestInvisible : EVisibility::Collapsed; })
 					]
 					// Title spacer
 					+SVerticalBox::Slot()
@@ -179,7 +188,7 @@ void SLintWizard::Construct(const FArguments& InArgs)
 				// Marketplace Info Page
 				+ SWizard::Page()
 				.OnEnter(this, &SLintWizard::OnMarketplaceRecommendationsEntered)
-				.CanShow_Lambda([&]() { return LintReport.IsValid() && LintReport->bHasRanReport && LintReport->NumErrors <= 0 && LintReport->LastUsedRuleSet != nullptr && LintReport->LastUsedRuleSet->bShowMarketplacePublishingInfoInLintWizard; })
+				.CanShow_Lambda([&]() { return LintReport.IsValid() && LintReport->bHasRanReport && LintReport->NumErrors <= 0 && LintReport->ShowsMarketplacePublishingInfo(); })
 				[
 					SNew(SVerticalBox)
 					// Title
@@ -254,63 +263,37 @@ void SLintWizard::Construct(const FArguments& InArgs)
 								.ShowStepStatusIcon(false)
 								.StepStatus_Lambda([this]() { return FixUpRedirectorStatus; })
 								.StepActionText(LOCTEXT("FixUpRedirectsStepAction", "Fix Up Redirectors"))
+								.CanCancel(true)
 								.OnPerformAction_Lambda([this](FScopedSlowTask& ScopedSlowTask)
 								{
 									FixUpRedirectorStatus = EStepStatus::InProgress;
-									bool bSuccess = true;
-
-									FAssetRegistryModule& AssetRegistryModule = FModuleManager::Get().LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-									ScopedSlowTask.EnterProgressFrame(0, LOCTEXT("Linter.FixUpRedirects.FindingRedirectors", "Looking For redirectors..."));
 
-									// Form a filter from the paths
-									FARFilter Filter;
-									Filter.bRecursivePaths = true;
-									Filter.PackagePaths.Add("/Game");
-									Filter.ClassNames.Add("ObjectRedirector");
+									// Referencers are loaded a batch at a time rather than all at once, so large projects don't run out of memory
+									ScopedSlowTask.EnterProgressFrame(1.0f, LOCTEXT("Linter.FixUpRedirects.FixingUp", "Fixing up redirectors..."));
+									const int64 MaxBatchBytes = (int64)GetDefault<ULinterSettings>()->RedirectorFixupBatchSizeMB * 1024 * 1024;
+									const FLintRedirectorFixupResult Result = FLintRedirectorFixer::FixUpRedirectorsInPath(TEXT("/Game"), MaxBatchBytes);
 
-									// Query for a list of assets in the selected paths
-									TArray<FAssetData> AssetList;
-									AssetRegistryModule.Get().GetAssets(Filter, AssetList);
-
-									if (AssetList.Num() > 0)
+									if (Result.NumFailedToLoad > 0)
 									{
-										TArray<FString> ObjectPaths;
-										for (const auto& Asset : AssetList)
-										{
-											ObjectPaths.Add(Asset.ObjectPath.ToString());
-										}
-
-										ScopedSlowTask.EnterProgressFrame(0.25f, LOCTEXT("Linter.FixUpRedirects.LoadingRedirectors", "Loading redirectors..."));
-
-										TArray<UObject*> Objects;
-										if (LoadAssetsIfNeeded(ObjectPaths, Objects))
-										{
-											// Transform Objects array to ObjectRedirectors array
-											TArray<UObjectRedirector*> Redirectors;
-											for (auto Object : Objects)
-											{
-												auto Redirector = CastChecked<UObjectRedirector>(Object);
-												Redirectors.Add(Redirector);
-											}
-
-											ScopedSlowTask.EnterProgressFrame(0.25f, LOCTEXT("Linter.FixUpRedirects.LoadingRedirectors", "Fixing up redirectors..."));
-
-											// Load the asset tools module
-											FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>(TEXT("AssetTools"));
-											AssetToolsModule.Get().FixupReferencers(Redirectors);
-										}
-										else
-										{
-											FNotificationInfo NotificationInfo(LOCTEXT("FixUpRedirectorsFailed", "Linter failed to load an object redirector when trying to fix up all redirectors."));
-											NotificationInfo.ExpireDuration = 6.0f;
-											NotificationInfo.Hyperlink = FSimpleDelegate::CreateStatic([]() { FMessageLog("LoadErrors").Open(EMessageSeverity::Info, true); });
-											NotificationInfo.HyperlinkText = LOCTEXT("LoadObjectHyperlink", "Show Message Log");
-											FSlateNotificationManager::Get().AddNotification(NotificationInfo);
-											bSuccess = false;
-										}
+										FNotificationInfo NotificationInfo(LOCTEXT("FixUpRedirectorsFailed", "Linter failed to load an object redirector when trying to fix up all redirectors."));
+										NotificationInfo.ExpireDuration = 6.0f;
+										NotificationInfo.Hyperlink = FSimpleDelegate::CreateStatic([]() { FMessageLog("LoadErrors").Open(EMessageSeverity::Info, true); });
+										NotificationInfo.HyperlinkText = LOCTEXT("LoadObjectHyperlink", "Show Message Log");
+										FSlateNotificationManager::Get().AddNotification(NotificationInfo);
+									}
+									else if (Result.bCancelled)
+									{
+										FNotificationInfo NotificationInfo(FText::Format(LOCTEXT("FixUpRedirectorsCancelled", "Fixed up {0} of {1} redirectors before being cancelled. Fix up redirectors again to continue."), Result.NumFixedUp, Result.NumRedirectors));
+										NotificationInfo.ExpireDuration = 6.0f;
+										FSlateNotificationManager::Get().AddNotification(NotificationInfo);
 									}
 
-									FixUpRedirectorStatus = bSuccess ? EStepStatus::Success : EStepStatus::Error;
+									FixUpRedirectorStatus = Result.Succeeded() ? EStepStatus::Success : EStepStatus::Error;
+									if (Result.bCancelled && Result.NumFailedToLoad == 0)
+									{
+										// A cancelled fix up isn't a failure, it just isn't done yet
+										FixUpRedirectorStatus = EStepStatus::Unknown;
+									}
 								})
 							]
 							// Build Lighting Widget
@@ -571,7 +554,36 @@ END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 void SLintWizard::OnLintReportEntered()
 {
-	LintReport->Rebuild(CastChecked<ULintRuleSet>(SelectedRuleSet->GetAsset()));
+	// First use of the picked rule sets, so this is where they get loaded. Rebuild falls back to the default rule set if none of them load
+	TArray<const ULintRuleSet*> LoadedRuleSets;
+	for (const TSharedPtr<FAssetData>& SelectedRuleSet : SelectedRuleSets)
+	{
+		if (const ULintRuleSet* LoadedRuleSet = Cast<ULintRuleSet>(SelectedRuleSet->GetAsset()))
+		{
+			LoadedRuleSets.Add(LoadedRuleSet);
+		}
+	}
+
+	if (LoadedRuleSets.Num() > 0)
+	{
+		LintReport->Rebuild(LoadedRuleSets);
+	}
+	else
+	{
+		LintReport->Rebuild(nullptr);
+	}
+}
+
+FText SLintWizard::GetRuleSetDescription(const FAssetData& RuleSetData)
+{
+	// Rule sets saved before the description was searchable don't have the tag until they are resaved
+	FText RuleSetDescription;
+	if (RuleSetData.GetTagValue(GET_MEMBER_NAME_CHECKED(ULintRuleSet, RuleSetDescription), RuleSetDescription) && !RuleSetDescription.IsEmpty())
+	{
+		return RuleSetDescription;
+	}
+
+	return FText::FromName(RuleSetData.ObjectPath);
 }
 
 void SLintWizard::OnMarketplaceRecommendationsEntered()
@@ -28,6 +28,7 @@ void SStepWidget::Construct(const FArguments& Args)
 	OnPerformAction = Args._OnPerformAction;
 	StepActionText = Args._StepActionText;
 	ShowStepStatusIcon = Args._ShowStepStatusIcon;
+	bCanCancel = Args._CanCancel;
 
 	// Visibility lambda based on whether step is in progress
 	auto VisibleIfInProgress = [this]()
@@ -139,7 +140,7 @@ void SStepWidget::Construct(const FArguments& Args)
 							.OnClicked_Lambda([&]()
 							{
 								FScopedSlowTask SlowTask(1.0f, StepActionText.Get(FText()));
-								SlowTask.MakeDialog();
+								SlowTask.MakeDialog(bCanCancel);
 
 								OnPerformAction.ExecuteIfBound(SlowTask);
 								return FReply::Handled();
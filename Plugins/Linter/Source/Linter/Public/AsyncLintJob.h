@@ -0,0 +1,148 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetData.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeBool.h"
+#include "UObject/GCObject.h"
+#include "UObject/ObjectKey.h"
+#include "LintRule.h"
+
+class ULintRule;
+class ULintRuleSet;
+
+/** The violations found in a single linted asset. */
+struct FLintAssetResult
+{
+	FAssetData AssetData;
+	UObject* LintedObject = nullptr;
+	TArray<FLintRuleViolation> RuleViolations;
+
+	/** False if the job was cancelled while this asset was being linted, in which case RuleViolations may be incomplete. */
+	bool bCompleted = false;
+};
+
+/**
+ * Lints a list of assets without blocking the game thread.
+ * Assets are loaded a few at a time on the game thread, rules that do not require the game thread run on the thread pool,
+ * rules that do, including every rule implemented in Blueprint, run on the game thread within a per-tick time budget,
+ * and results are queued up so that UI can drain them in batches whenever it ticks.
+ */
+class LINTER_API FAsyncLintJob : public TSharedFromThis<FAsyncLintJob>, public FGCObject
+{
+public:
+	FAsyncLintJob(const ULintRuleSet* InRuleSet, const TArray<FAssetData>& InAssetList);
+
+	/** Lints every asset with each of InRuleSets, loading each asset only once. Violations are tagged with the rule set that found them. */
+	FAsyncLintJob(const TArray<const ULintRuleSet*>& InRuleSets, const TArray<FAssetData>& InAssetList);
+	virtual ~FAsyncLintJob();
+
+	/** Starts loading and linting assets. Must be called on the game thread. */
+	void Start();
+
+	/** Stops dispatching new assets and asks in-flight assets to finish early. Violations found so far can still be drained. */
+	void Cancel();
+
+	/**
+	 * Moves all violations that have been found since the last call into OutRuleViolations, and optionally the assets that were fully linted into OutLintedAssets.
+	 * Must be called on the game thread.
+	 */
+	void DrainResults(TArray<FLintRuleViolation>& OutRuleViolations, TArray<FAssetData>* OutLintedAssets = nullptr);
+
+	/** True once every asset has been linted, or the job was cancelled and all in-flight assets have drained. */
+	bool IsFinished() const;
+
+	bool IsCancelled() const { return SharedState->CancellationToken.IsCancelled(); }
+	int32 GetNumAssets() const { return AssetList.Num() + NumAssetsSkipped; }
+	int32 GetNumAssetsCompleted() const { return NumAssetsCompleted; }
+
+	/** Assets that no rule list applies to. These are never loaded and are reported as linted without violations. */
+	int32 GetNumAssetsSkipped() const { return NumAssetsSkipped; }
+
+	/** Stable sorts AssetList so that assets in earlier PriorityPaths come first. Assets outside of every priority path keep their order at the end. */
+	static void PrioritizeAssetsInPaths(TArray<FAssetData>& AssetList, const TArray<FString>& PriorityPaths);
+
+	//~ Begin FGCObject Interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FAsyncLintJob"); }
+	//~ End FGCObject Interface
+
+private:
+	bool Tick(float DeltaTime);
+	void LintObject(const FAssetData& Asset, UObject* Object);
+
+	/**
+	 * Runs queued game thread rules within BudgetSeconds, most expensive first, skipping rules estimated not to fit in what's left of the budget.
+	 * If nothing fits, the cheapest rule runs on its own, so every call makes progress while keeping that over budget frame as short as possible.
+	 */
+	void RunGameThreadWork(double BudgetSeconds);
+
+	/** An asset whose rules are split between a thread pool task and one game thread work item per game thread rule. The last to finish queues the result. */
+	struct FPendingAsset
+	{
+		FLintAssetResult Result;
+
+		/** Violations found by game thread rules, kept apart from the thread pool runner's until both are done. */
+		TArray<FLintRuleViolation> GameThreadRuleViolations;
+
+		FThreadSafeCounter NumPartsRemaining;
+		FThreadSafeBool bCancelled;
+	};
+
+	/** One game thread rule of one rule set to run against one asset. */
+	struct FGameThreadWorkItem
+	{
+		TSharedPtr<FPendingAsset, ESPMode::ThreadSafe> Pending;
+		const ULintRuleSet* RuleSet = nullptr;
+		const ULintRule* Rule = nullptr;
+		int64 PackageBytes = 0;
+		double EstimatedSeconds = 0.0;
+	};
+
+	/** Runs a single game thread rule and returns how long it took. */
+	double RunGameThreadWorkItem(const FGameThreadWorkItem& Item);
+
+	/** Estimates how long Rule takes on a package of PackageBytes from how long it took per byte so far. */
+	static double EstimateGameThreadSeconds(const ULintRule* Rule, int64 PackageBytes);
+
+	/** State shared with worker threads, which may outlive any single tick of this job. */
+	struct FSharedState
+	{
+		FLintCancellationToken CancellationToken;
+		TQueue<FLintAssetResult, EQueueMode::Mpsc> Results;
+		FThreadSafeCounter NumInFlight;
+	};
+
+	/** Called by the thread pool runner and each game thread work item of Pending when they're done. The last one queues the asset's result. */
+	static void FinishPart(FSharedState& State, FPendingAsset& Pending, bool bPartCompleted);
+
+	TArray<const ULintRuleSet*> RuleSets;
+	TArray<FAssetData> AssetList;
+	TSharedRef<FSharedState, ESPMode::ThreadSafe> SharedState;
+
+	/** Objects currently being linted, kept referenced so they can't be garbage collected from under a worker. */
+	TArray<UObject*> InFlightObjects;
+
+	/** Game thread rules of assets that have been dispatched and haven't run yet. */
+	TArray<FGameThreadWorkItem> GameThreadWork;
+
+	/** Smoothed seconds per package byte each game thread rule class has taken, shared by every job in the session. Only used on the game thread. */
+	static TMap<FObjectKey, double> GameThreadRuleSecondsPerByte;
+
+	int32 NextAssetIndex = 0;
+	int32 NumAssetsCompleted = 0;
+	int32 NumAssetsSkipped = 0;
+	FDelegateHandle TickerHandle;
+
+	/** How many assets may be loaded and dispatched in a single tick. */
+	static const int32 MaxAssetsStartedPerTick = 8;
+
+	/** Assumed cost of a game thread rule that hasn't run yet. Kept small so the first measurement happens soon. */
+	static constexpr double DefaultGameThreadRuleSeconds = 0.001;
+
+	/** Assumed size of a package the asset registry has no size for. */
+	static const int64 DefaultPackageBytes = 1024 * 1024;
+};
@@ -10,6 +10,8 @@
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/Layout/SUniformGridPanel.h"
 #include "Widgets/Layout/SSeparator.h"
+#include "Widgets/Views/SListView.h"
+#include "BatchRenameTool/BatchRenamer.h"
 
 #define LOCTEXT_NAMESPACE "LinterBatchRenamer"
 
@@ -63,6 +65,8 @@ public:
 		{}
 		/** Window in which this widget resides */
 		SLATE_ATTRIBUTE(TSharedPtr<SWindow>, ParentWindow)
+		/** Assets to rename, used to preview the new names */
+		SLATE_ARGUMENT(TArray<FAssetData>, Assets)
 	SLATE_END_ARGS()
 
 	/**
@@ -78,8 +82,16 @@ public:
 	*/
 	FDlgBatchRenameTool::EResult GetUserResponse() const;
 
+	/** The name operations currently entered in the dialog. */
+	FBatchRenameOptions GetOptions() const;
+
 private:
 
+	/** Plans the rename with the current options so the preview shows every new name and conflict. */
+	void RefreshPreview();
+	FText GetPreviewSummary() const;
+	TSharedRef<ITableRow> OnGeneratePreviewRow(TSharedPtr<FBatchRenameEntry> Entry, const TSharedRef<STableViewBase>& OwnerTable);
+
 	/**
 	* Handles when a button is pressed, should be bound with appropriate EResult Key
 	*
@@ -99,6 +111,15 @@ private:
 	/** Pointer to the window which holds this Widget, required for modal control */
 	TSharedPtr<SWindow>	ParentWindow;
 
+	TArray<FAssetData> Assets;
+
+	/** Gathered once when the dialog opens, so previews don't query the asset registry on every keystroke */
+	TSet<FName> ExistingPackageNames;
+
+	TArray<TSharedPtr<FBatchRenameEntry>> PreviewEntries;
+	int32 NumPreviewConflicts = 0;
+	TSharedPtr<SListView<TSharedPtr<FBatchRenameEntry>>> PreviewListView;
+
 public:
 
 	TSharedPtr<SEditableTextBox> PrefixTextBox;
@@ -0,0 +1,78 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetData.h"
+
+struct FLintRuleViolation;
+
+/** The name operations of a batch rename, applied in order: find and replace, then prefix, then suffix. */
+struct FBatchRenameOptions
+{
+	FString Prefix;
+	FString Suffix;
+	bool bRemovePrefix = false;
+	bool bRemoveSuffix = false;
+
+	FString Find;
+	FString Replace;
+
+	bool IsEmpty() const { return Prefix.IsEmpty() && Suffix.IsEmpty() && Find.IsEmpty(); }
+
+	/** Returns AssetName with every operation applied. */
+	FString Apply(const FString& AssetName) const;
+};
+
+/** One asset a batch rename would rename. */
+struct FBatchRenameEntry
+{
+	FAssetData AssetData;
+	FString NewName;
+
+	/** Why this asset can't be renamed to NewName, or empty if it can. */
+	FText Conflict;
+
+	bool HasConflict() const { return !Conflict.IsEmpty(); }
+};
+
+/**
+ * Plans and performs batch renames of many assets at once.
+ * Planning works on asset data alone, so nothing is loaded until the rename actually runs, and renames run in chunks
+ * that each fix up their redirectors, save, and unload what they saved before the next one, so memory use stays flat.
+ * Packages with unsaved changes or open in an editor are left loaded.
+ */
+class FBatchRenamer
+{
+public:
+	/** Package names of every asset in the folders of Assets, which renamed assets must not collide with. */
+	static TSet<FName> GatherExistingPackageNames(const TArray<FAssetData>& Assets);
+
+	/**
+	 * Computes the new name of every asset that can be renamed and whose name changes, in parallel and without loading anything.
+	 * Entries that would collide with an existing package or another entry, or whose new name is invalid, are flagged with a conflict.
+	 */
+	static TArray<FBatchRenameEntry> Plan(const TArray<FAssetData>& Assets, const FBatchRenameOptions& Options, const TSet<FName>& ExistingPackageNames);
+
+	/**
+	 * Plans renaming every violator to the name its violation suggests, using the violations' asset data so nothing is loaded.
+	 * Works on cached results whose violators were never loaded. An asset with several suggestions keeps the first one.
+	 */
+	static TArray<FBatchRenameEntry> PlanFromSuggestedNames(const TArray<FLintRuleViolation>& RuleViolations);
+
+	/**
+	 * Renames every entry without a conflict, ChunkSize assets at a time, with a cancellable progress dialog.
+	 * After each chunk the redirectors it left behind are fixed up and deleted, and the renamed packages are saved.
+	 * Returns false if any rename failed or the user cancelled.
+	 */
+	static bool Execute(const TArray<FBatchRenameEntry>& Entries, int32 ChunkSize = DefaultChunkSize);
+
+	static const int32 DefaultChunkSize = 64;
+
+	/** Only real assets can be renamed; not redirectors, classes or cooked packages. */
+	static bool CanRename(const FAssetData& Asset);
+
+private:
+	/** Flags entries whose new name is invalid or collides with an existing package or another entry. */
+	static void FlagConflicts(TArray<FBatchRenameEntry>& Entries, const TSet<FName>& ExistingPackageNames);
+};
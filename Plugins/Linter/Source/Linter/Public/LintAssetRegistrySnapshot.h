@@ -0,0 +1,32 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Saves the asset registry to disk together with the timestamp of every package file it was built from,
+ * so that a later run can load it instead of scanning the whole project, and only rescan the packages that changed since.
+ */
+class LINTER_API FLintAssetRegistrySnapshot
+{
+public:
+	/**
+	 * Loads the snapshot into the asset registry and rescans every package that was added or modified since it was saved.
+	 * Returns false without touching the asset registry if the snapshot is missing, unreadable, or packages were deleted since,
+	 * in which case the caller should fall back to a full scan. OutNumRescannedPackages is how many packages had to be rescanned.
+	 */
+	static bool Load(const FString& Filename, int32& OutNumRescannedPackages);
+
+	/** Saves the asset registry, which should have been fully scanned or loaded from an up to date snapshot. */
+	static bool Save(const FString& Filename);
+
+	/**
+	 * Compares the snapshot against the asset registry, which must have just been fully scanned. Every package that hasn't changed
+	 * since the snapshot was saved must have the same assets, tags, package data and dependencies. Logs each package that doesn't.
+	 */
+	static bool Verify(const FString& Filename);
+
+private:
+	/** Timestamps of every package file in every mounted content root, keyed by long package name. */
+	static TMap<FString, FDateTime> GatherPackageTimestamps();
+};
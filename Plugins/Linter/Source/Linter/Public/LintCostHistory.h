@@ -0,0 +1,55 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetData.h"
+
+/**
+ * Remembers how long each package took to load and lint, persisted under Saved/Linter between runs, so that the most expensive
+ * assets can be started first instead of holding up the end of a run. Packages that haven't been linted before are estimated
+ * from their size on disk, using the average seconds per byte of every package that has.
+ */
+class LINTER_API FLintCostHistory
+{
+public:
+	static FLintCostHistory& Get();
+
+	/** Records how long loading and linting a package took. Safe to call from any thread. */
+	void RecordDuration(FName PackageName, int64 PackageBytes, double Seconds);
+
+	/** How long Asset is expected to take: its recorded duration if it has one, otherwise its package size times the average seconds per byte. */
+	double EstimateSeconds(const FAssetData& Asset) const;
+
+	/** Stable sorts AssetList so the assets expected to take longest come first. Must be called on the game thread. */
+	void SortLongestFirst(TArray<FAssetData>& AssetList) const;
+
+	/** Writes the history to disk if anything was recorded since it was loaded or last saved. */
+	void SaveIfDirty();
+
+	/** The on-disk size of a package according to the asset registry, or 0 if it doesn't know. Must be called on the game thread. */
+	static int64 GetPackageBytes(FName PackageName);
+
+private:
+	FLintCostHistory();
+
+	struct FPackageCost
+	{
+		float Seconds = 0.0f;
+		int64 Bytes = 0;
+	};
+
+	static FString GetHistoryFilename();
+	void Load();
+
+	/** Seconds per byte over every recorded package, used to estimate packages without a recorded duration. */
+	double GetAverageSecondsPerByte() const;
+
+	TMap<FName, FPackageCost> PackageCosts;
+	double TotalSeconds = 0.0;
+	int64 TotalBytes = 0;
+	bool bDirty = false;
+	mutable FCriticalSection Lock;
+
+	/** Used until anything has been recorded. Only the relative order of estimates matters, so any positive rate will do. */
+	static constexpr double DefaultSecondsPerByte = 1.0e-8;
+};
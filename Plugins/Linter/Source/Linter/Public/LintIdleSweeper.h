@@ -0,0 +1,42 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetData.h"
+#include "Containers/Ticker.h"
+
+/**
+ * Lints /Game with the default rule set a single asset at a time while nobody is using the editor, if enabled in the Linter settings.
+ * Work is time sliced on the game thread so the sweep stays within its CPU share and stops as soon as there's input.
+ * Progress is checkpointed under Saved/Linter so a sweep resumes where it left off in the next session,
+ * and every result is stored in the FLintResultCache that the lint report reads from.
+ */
+class FLintIdleSweeper
+{
+public:
+	FLintIdleSweeper();
+	~FLintIdleSweeper();
+
+private:
+	bool Tick(float DeltaTime);
+	bool IsEditorIdle() const;
+
+	void StartPass();
+	void FinishPass();
+
+	void LoadCheckpoint();
+	void SaveCheckpoint();
+	static FString GetCheckpointFilename();
+
+	/** Assets of the current pass, sorted by package name so a checkpoint is just the last package that was swept. */
+	TArray<FAssetData> PassAssets;
+	int32 NextAssetIndex = 0;
+	FName CheckpointPackageName;
+	int32 NumLintedSinceCheckpoint = 0;
+
+	/** Seconds of game thread time the sweep may still spend. Grows with real time according to the CPU share. */
+	double TimeBudget = 0.0;
+	double LastPassFinishedTime = -MAX_dbl;
+
+	FDelegateHandle TickerHandle;
+};
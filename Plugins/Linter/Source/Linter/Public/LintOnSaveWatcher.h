@@ -0,0 +1,45 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetData.h"
+#include "Containers/Ticker.h"
+#include "LintRule.h"
+
+class FAsyncLintJob;
+class ULintRuleSet;
+
+/**
+ * Lints assets with the default rule set as they are saved, imported or renamed, if enabled in the Linter settings.
+ * Events are coalesced until none have arrived for a short while, so a batch import is linted as a single background job.
+ */
+class FLintOnSaveWatcher
+{
+public:
+	FLintOnSaveWatcher();
+	~FLintOnSaveWatcher();
+
+private:
+	void OnPackageSaved(const FString& PackageFileName, UObject* Outer);
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	void QueuePackage(FName PackageName);
+	bool Tick(float DeltaTime);
+	void StartLintJob();
+	void FinishLintJob();
+
+	/** Packages waiting for the next job. */
+	TSet<FName> PendingPackageNames;
+	double LastEventTime = 0.0;
+
+	TSharedPtr<FAsyncLintJob> LintJob;
+	TArray<FLintRuleViolation> LintJobRuleViolations;
+	TArray<FAssetData> LintJobLintedAssets;
+	TWeakObjectPtr<const ULintRuleSet> LintJobRuleSet;
+
+	FDelegateHandle PackageSavedDelegateHandle;
+	FDelegateHandle AssetAddedDelegateHandle;
+	FDelegateHandle AssetRenamedDelegateHandle;
+	FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,53 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetData.h"
+
+/** Redirectors that are fixed up together, along with every package that references them. */
+struct FLintRedirectorBatch
+{
+	TArray<FAssetData> Redirectors;
+	TSet<FName> ReferencingPackages;
+
+	/** The combined on-disk size of ReferencingPackages, as an estimate of how much fixing up this batch loads. */
+	int64 EstimatedBytes = 0;
+};
+
+/** What happened while fixing up the redirectors in a path. */
+struct FLintRedirectorFixupResult
+{
+	int32 NumRedirectors = 0;
+	int32 NumFixedUp = 0;
+	int32 NumFailedToLoad = 0;
+	bool bCancelled = false;
+
+	/** True if every redirector was fixed up and deleted. */
+	bool Succeeded() const { return !bCancelled && NumFixedUp == NumRedirectors; }
+};
+
+/**
+ * Fixes up redirectors a batch at a time, so that only the packages referencing one batch are ever loaded at once.
+ * Each batch is saved and its redirectors deleted before the next one starts, so an interrupted run picks up where it stopped
+ * simply by running again: only redirectors that haven't been fixed up yet are found.
+ */
+class LINTER_API FLintRedirectorFixer
+{
+public:
+	/**
+	 * Groups redirectors using the asset registry's referencer graph alone, without loading anything.
+	 * Redirectors that share a referencer or point at each other always end up in the same batch, so no package is loaded and saved twice,
+	 * and independent groups are packed together until a batch would reference more than MaxBatchBytes of packages.
+	 * A single group larger than MaxBatchBytes becomes a batch of its own.
+	 */
+	static TArray<FLintRedirectorBatch> PlanBatches(const TArray<FAssetData>& Redirectors, int64 MaxBatchBytes);
+
+	/** Fixes up every redirector under PackagePath in batches, with cancellable progress, unloading each batch's referencers and collecting garbage after it. */
+	static FLintRedirectorFixupResult FixUpRedirectorsInPath(FName PackagePath, int64 MaxBatchBytes);
+
+	/**
+	 * Unloads every loaded package in PackageNames that has no unsaved changes, has no asset open in an editor and isn't the level being edited.
+	 * Saved assets are standalone, so garbage collection alone never frees them. Returns the number of packages unloaded.
+	 */
+	static int32 UnloadSavedPackages(const TArray<FName>& PackageNames);
+};
@@ -0,0 +1,108 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetData.h"
+#include "LintRule.h"
+
+class ULintRuleSet;
+
+/** Error and warning counts from the last lint of a package, or rolled up over every package under a folder. */
+struct FLintStatusCounts
+{
+	int32 NumErrors = 0;
+	int32 NumWarnings = 0;
+
+	/** False if the package has been saved since it was linted. Always true for folders. */
+	bool bUpToDate = true;
+
+	bool HasViolations() const { return NumErrors > 0 || NumWarnings > 0; }
+};
+
+/**
+ * Remembers the violations found in each package per rule set, persisted under Saved/Linter between editor sessions.
+ * Results are keyed by the package GUID the asset registry reports, which changes every time a package is saved, and are thrown
+ * away whenever the rule set, its naming convention or one of its Blueprint rules is saved, or Linter itself changes version,
+ * so a cached result is never older than the asset or the rules.
+ */
+class LINTER_API FLintResultCache
+{
+public:
+	static FLintResultCache& Get();
+
+	/** Records the results of fully linting LintedAssets. Assets without violations are recorded as clean. Violations tagged with another rule set are ignored. */
+	void StoreResults(const ULintRuleSet* RuleSet, const TArray<FAssetData>& LintedAssets, const TArray<FLintRuleViolation>& RuleViolations);
+
+	/** True if the package has been linted with this rule set since it was last saved. */
+	bool IsUpToDate(const ULintRuleSet* RuleSet, FName PackageName) const;
+
+	/** Removes every asset with up to date results from InOutAssetList and appends their cached violations to OutRuleViolations. */
+	void TakeUpToDateResults(const ULintRuleSet* RuleSet, TArray<FAssetData>& InOutAssetList, TArray<FLintRuleViolation>& OutRuleViolations) const;
+
+	/**
+	 * Cached counts for a package without running any rules. RuleSetPath is the object path of the rule set.
+	 * Only a couple of map lookups, so it is cheap enough to call for every visible Content Browser tile.
+	 */
+	FLintStatusCounts GetPackageStatus(FName RuleSetPath, FName PackageName) const;
+
+	/** Counts of every cached package under FolderPath (e.g. /Game/Maps), kept rolled up as results are stored. */
+	FLintStatusCounts GetFolderStatus(FName RuleSetPath, FName FolderPath) const;
+
+	/** Writes the cache to disk if anything changed since it was loaded or last saved. */
+	void SaveIfDirty();
+
+	/** Broadcast whenever results are stored. */
+	FSimpleMulticastDelegate& OnResultsChanged() { return ResultsChangedEvent; }
+
+private:
+	FLintResultCache();
+
+	struct FCachedViolation
+	{
+		FName ObjectPath;
+		FSoftClassPath RuleClass;
+		FString RecommendedAction;
+		FString SuggestedName;
+	};
+
+	struct FCachedPackage
+	{
+		FGuid PackageGuid;
+		int32 NumErrors = 0;
+		int32 NumWarnings = 0;
+		TArray<FCachedViolation> Violations;
+	};
+
+	/** A folder in the path trie, holding the totals of every package below it. */
+	struct FFolderNode
+	{
+		int32 ParentIndex = INDEX_NONE;
+		int32 NumErrors = 0;
+		int32 NumWarnings = 0;
+	};
+
+	struct FCachedRuleSet
+	{
+		/** The package GUID of every package in ULintRuleSet::GetDependencyPackageNames when the results were stored. */
+		TMap<FName, FGuid> DependencyGuids;
+		TMap<FName, FCachedPackage> Packages;
+
+		/** Path trie of folders linked to their parents, with FolderIndices for direct lookups by folder path. */
+		TArray<FFolderNode> Folders;
+		TMap<FName, int32> FolderIndices;
+	};
+
+	const FCachedRuleSet* FindRuleSet(const ULintRuleSet* RuleSet) const;
+	const FCachedRuleSet* FindRuleSet(FName RuleSetPath) const;
+	static int32 FindOrAddFolder(FCachedRuleSet& CachedRuleSet, const FString& FolderPath);
+	static void RollUpPackage(FCachedRuleSet& CachedRuleSet, FName PackageName, int32 DeltaErrors, int32 DeltaWarnings);
+	static FGuid GetPackageGuid(FName PackageName);
+	static TMap<FName, FGuid> GetDependencyGuids(const ULintRuleSet* RuleSet);
+	static bool AreDependenciesUpToDate(const FCachedRuleSet& CachedRuleSet);
+	static FString GetCacheFilename();
+	void Load();
+
+	TMap<FName, FCachedRuleSet> RuleSets;
+	bool bDirty = false;
+	FSimpleMulticastDelegate ResultsChangedEvent;
+};
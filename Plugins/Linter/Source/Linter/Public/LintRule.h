@@ -2,6 +2,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/ThreadSafeBool.h"
 #include "LintRule.generated.h"
 
 UENUM(BlueprintType)
@@ -13,6 +14,49 @@ enum class ELintRuleSeverity : uint8
 //	Ignore
 };
 
+/**
+ * Shared by everything taking part in a lint run so that the run can be cancelled cooperatively.
+ * Tokens can be chained: a token is cancelled if it or any of its parents is cancelled.
+ */
+class LINTER_API FLintCancellationToken
+{
+public:
+	FLintCancellationToken(const FLintCancellationToken* InParent = nullptr)
+		: Parent(InParent)
+	{
+	}
+
+	void Cancel()
+	{
+		bCancelled = true;
+	}
+
+	bool IsCancelled() const
+	{
+		return bCancelled || (Parent != nullptr && Parent->IsCancelled());
+	}
+
+	/** Returns true if the lint run executing on the calling thread has been cancelled. */
+	static bool IsCurrentRunCancelled();
+
+	/** The token of the lint run executing on the calling thread, if any, so work fanned out to other threads can stay cancellable. */
+	static const FLintCancellationToken* GetCurrent();
+
+	/** Makes a token the current token of the calling thread for the lifetime of this scope. */
+	struct LINTER_API FScope
+	{
+		FScope(const FLintCancellationToken* Token);
+		~FScope();
+
+	private:
+		const FLintCancellationToken* PreviousToken;
+	};
+
+private:
+	const FLintCancellationToken* Parent;
+	FThreadSafeBool bCancelled;
+};
+
 USTRUCT(BlueprintType)
 struct LINTER_API FLintRuleViolation
 {
@@ -57,6 +101,14 @@ struct LINTER_API FLintRuleViolation
 	UPROPERTY(EditAnywhere, Category = "Lint")
 	FText RecommendedAction;
 
+	/** The name the violator should be renamed to, if the violated rule can suggest one. Empty otherwise. */
+	UPROPERTY(EditAnywhere, Category = "Lint")
+	FString SuggestedName;
+
+	/** The report name of the rule set that found this violation, so results of several rule sets linted together can be told apart. */
+	UPROPERTY(EditAnywhere, Category = "Lint")
+	FName RuleSetName;
+
 	FAssetData ViolatorAssetData;
 };
 
@@ -87,15 +139,33 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Display")
 	ELintRuleSeverity RuleSeverity;
 
+	/** Forces this rule to run on the game thread. Rules implemented in Blueprint always run on the game thread, whether this is set or not. */
 	UPROPERTY(EditDefaultsOnly, Category = "Settings", AdvancedDisplay)
 	bool bRequiresGameThread = false;
 
+	/** True if bRequiresGameThread is set, or if this rule's class overrides any of ULintRule's events in Blueprint, since script may only run on the game thread. */
+	bool RequiresGameThread() const;
+
 	UFUNCTION(BlueprintCallable, Category = "Lint")
 	virtual bool PassesRule(UObject* ObjectToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const;
+
+	/** True if this rule would rather check many objects at once through PassesRuleBatch than one at a time through PassesRule. */
+	virtual bool LintsInBatches() const { return false; }
+
+	/**
+	 * Checks many objects of the same class at once, appending to OutRuleViolations, and returns false if any of them violated this rule.
+	 * ULintRuleSet::LintAssets calls this on rules that LintsInBatches once every asset is loaded, with one batch per class, instead of calling PassesRule.
+	 * The default calls PassesRule on each object. Rules checking a few plain fields can override it to pull those fields out and check them all in one tight loop.
+	 */
+	virtual bool PassesRuleBatch(TArrayView<UObject* const> ObjectsToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const;
 	
 	UFUNCTION(BlueprintCallable, Category = "Display")
 	virtual bool IsRuleSuppressed() const;
 
+	/** Returns true if the lint run this rule is being evaluated in has been cancelled. Long running rules should check this periodically and bail out. */
+	UFUNCTION(BlueprintCallable, Category = "Lint")
+	static bool IsLintRunCancelled();
+
 	UFUNCTION(BlueprintNativeEvent, Category = "Display")
 	FName GetRuleBasedObjectVariantName(UObject* ObjectToLint) const;
 
@@ -9,6 +9,14 @@
 
 class ULinterNamingConvention;
 
+/** Which rules of a rule list to run, so that rules that must run on the game thread can be split from the rest. */
+enum class ELintRuleThreadFilter : uint8
+{
+	AllRules,
+	GameThreadRules,
+	AnyThreadRules
+};
+
 USTRUCT(BlueprintType)
 struct LINTER_API FLintRuleList
 {
@@ -20,8 +28,35 @@ struct LINTER_API FLintRuleList
 	UPROPERTY(EditAnywhere, Category = Default)
 	TArray<TSubclassOf<ULintRule>> LintRules;
 
-	bool RequiresGameThread() const;;
-	bool PassesRules(UObject* ObjectToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const;
+	bool RequiresGameThread() const;
+
+	/** True if any rule passes Filter. */
+	bool HasRules(ELintRuleThreadFilter Filter) const;
+
+	/** The default object of every rule that passes Filter. */
+	TArray<const ULintRule*> GetRules(ELintRuleThreadFilter Filter) const;
+
+	/** Runs every rule that passes Filter, leaving out rules that lint in batches unless bIncludeBatchedRules is set. */
+	bool PassesRules(UObject* ObjectToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations, ELintRuleThreadFilter Filter = ELintRuleThreadFilter::AllRules, bool bIncludeBatchedRules = true) const;
+};
+
+/**
+ * Told about each asset as ULintRuleSet::LintAssets works through its list, so callers can record progress while the lint is still running.
+ * Every call happens on the game thread. Nothing is reported for assets left unfinished by a cancellation.
+ */
+class LINTER_API ILintAssetsProgress
+{
+public:
+	virtual ~ILintAssetsProgress() {}
+
+	/** Called right before Asset is loaded. */
+	virtual void OnAssetStarted(const FAssetData& Asset) {}
+
+	/** Called once every rule of Asset that doesn't lint in batches has run, while batched rules may still be waiting for the rest of the list. */
+	virtual void OnAssetChecked(const FAssetData& Asset) {}
+
+	/** Called once every rule has run for Asset, with all the violations found in it. Always follows OnAssetChecked. */
+	virtual void OnAssetFinished(const FAssetData& Asset, const TArray<FLintRuleViolation>& RuleViolations) {}
 };
 
 /**
@@ -38,27 +73,79 @@ public:
 	//UFUNCTION(BlueprintCallable, Category = "Conventions")
 	const FLintRuleList* GetLintRuleListForClass(TSoftClassPtr<UObject> Class) const;
 
+	/**
+	 * Removes every asset that no rule list applies to, resolving the rule list from the asset's class in the asset registry so nothing is loaded.
+	 * Assets whose class can't be resolved without loading are kept. Returns the number of assets removed, which are optionally added to OutSkippedAssets.
+	 */
+	int32 RemoveAssetsWithoutLintRules(TArray<FAssetData>& InOutAssetList, TArray<FAssetData>* OutSkippedAssets = nullptr) const;
+
+	/** Removes every asset that none of RuleSets has a rule list for. See the member version. */
+	static int32 RemoveAssetsWithoutLintRules(const TArray<const ULintRuleSet*>& RuleSets, TArray<FAssetData>& InOutAssetList, TArray<FAssetData>* OutSkippedAssets = nullptr);
+
 	UFUNCTION(BlueprintCallable, Category = "Conventions")
 	ULinterNamingConvention* GetNamingConvention() const;
 
+	/** Resolves the naming convention so that rules running off the game thread can use GetNamingConvention. Must be called on the game thread. */
+	void LoadNamingConvention() const;
+
+	/** The name violations found by this rule set are tagged with: NameForCommandlet, or the asset's name if it has none. */
+	FName GetReportName() const;
+
+	/**
+	 * The packages whose contents decide what this rule set reports: its own, its naming convention's and those of the Blueprint rules it uses.
+	 * Native rules live in script packages and are left out. Doesn't load anything.
+	 */
+	TArray<FName> GetDependencyPackageNames() const;
+
+	/** Tags every violation from StartIndex on that isn't tagged yet with this rule set's report name. */
+	void TagRuleViolations(TArray<FLintRuleViolation>& RuleViolations, int32 StartIndex = 0) const;
+
 	/** Invoke this with a list of asset paths to recursively lint all assets in paths. */
 	//UFUNCTION(BlueprintCallable, Category = "Lint")
-	TArray<FLintRuleViolation> LintPath(TArray<FString> AssetPaths, FScopedSlowTask* ParentScopedSlowTask = nullptr) const;
+	TArray<FLintRuleViolation> LintPath(TArray<FString> AssetPaths, FScopedSlowTask* ParentScopedSlowTask = nullptr, FLintCancellationToken* CancellationToken = nullptr) const;
+
+	/**
+	 * Lints an explicit list of assets, i.e. one previously gathered with GatherAssetsInPaths and then filtered.
+	 * Assets are loaded as needed, except those that no rule list applies to, which are skipped without being loaded.
+	 * If CancellationToken is cancelled, or the user cancels ParentScopedSlowTask, in-flight assets finish early and the violations found so far are returned.
+	 */
+	TArray<FLintRuleViolation> LintAssets(const TArray<FAssetData>& AssetList, FScopedSlowTask* ParentScopedSlowTask = nullptr, FLintCancellationToken* CancellationToken = nullptr) const;
+
+	/**
+	 * Lints an explicit list of assets with several rule sets at once, loading each asset only once and running every rule set's rule list for it.
+	 * Every violation is tagged with the report name of the rule set that found it. Violations are returned grouped by asset, in the order assets were started.
+	 * Progress, if given, is told about each asset as it is started, checked and finished.
+	 */
+	static TArray<FLintRuleViolation> LintAssets(const TArray<const ULintRuleSet*>& RuleSets, const TArray<FAssetData>& AssetList, FScopedSlowTask* ParentScopedSlowTask = nullptr, FLintCancellationToken* CancellationToken = nullptr, ILintAssetsProgress* Progress = nullptr);
+
+	/**
+	 * Returns the asset data of all assets recursively found in the given asset paths without loading any of them.
+	 * Pass bSearchAllAssets = false if the asset registry has already been fully loaded, to skip waiting on another scan.
+	 */
+	static TArray<FAssetData> GatherAssetsInPaths(TArray<FString> AssetPaths, bool bSearchAllAssets = true);
 
 	/** This is a temp dumb way to do this. */
-	TArray<TSharedPtr<FLintRuleViolation>> LintPathShared(TArray<FString> AssetPaths, FScopedSlowTask* ParentScopedSlowTask = nullptr) const;
+	TArray<TSharedPtr<FLintRuleViolation>> LintPathShared(TArray<FString> AssetPaths, FScopedSlowTask* ParentScopedSlowTask = nullptr, FLintCancellationToken* CancellationToken = nullptr) const;
 
 	UPROPERTY(EditDefaultsOnly, Category = "Marketplace")
 	bool bShowMarketplacePublishingInfoInLintWizard = false;
 
-	UPROPERTY(EditDefaultsOnly, Category = "Rules")
+	/** Shown when picking a rule set. Searchable so rule sets can be listed without loading them. */
+	UPROPERTY(EditDefaultsOnly, AssetRegistrySearchable, Category = "Rules")
 	FText RuleSetDescription;
 
-	UPROPERTY(EditDefaultsOnly, Category = "Commandlet")
+	/** Name used to pick this rule set with -RuleSet= on the commandlet. Searchable so the commandlet can find it without loading every rule set. */
+	UPROPERTY(EditDefaultsOnly, AssetRegistrySearchable, Category = "Commandlet")
 	FString NameForCommandlet;
 
 protected:
 
+	/**
+	 * Runs every rule that lints in batches over LintedObjects, one batch per rule and class. Batches of rules that require the game thread run here,
+	 * the rest in parallel. Violations are appended in the order each batch was first seen, so they come out the same every run.
+	 */
+	void RunBatchedRules(const TArray<UObject*>& LintedObjects, const FLintCancellationToken* CancellationToken, TArray<FLintRuleViolation>& OutRuleViolations) const;
+
 	UPROPERTY(EditDefaultsOnly, Category = "Rules")
 	TSoftObjectPtr<ULinterNamingConvention> NamingConvention;
 
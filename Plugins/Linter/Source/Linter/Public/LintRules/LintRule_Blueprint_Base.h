@@ -2,10 +2,13 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
 #include "LintRule.h"
 
 #include "LintRule_Blueprint_Base.generated.h"
 
+class UEdGraph;
+
 /**
  *Comment
  */
@@ -19,4 +22,34 @@ public:
 
 	// This does rule pre-checks. You probably want to override PassesRule_Internal_Implementation
 	virtual bool PassesRule(UObject* ObjectToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const override;
+
+protected:
+	/**
+	 * Calls CheckGraph on every graph and returns its results in the same order as Graphs, so rules report the same thing however the work was split.
+	 * Blueprints with at least MinGraphsToCheckInParallel graphs are checked in parallel, unless this rule requires the game thread,
+	 * so that one huge Blueprint doesn't hold up the end of a lint run. CheckGraph may only read the graph it's given.
+	 * Graphs not yet checked when the lint run is cancelled get a default constructed result.
+	 */
+	template<typename ResultType>
+	TArray<ResultType> CheckGraphs(const TArray<UEdGraph*>& Graphs, TFunctionRef<ResultType(const UEdGraph*)> CheckGraph) const
+	{
+		TArray<ResultType> Results;
+		Results.SetNum(Graphs.Num());
+
+		// The cancellation token is per thread, so hand it to whichever threads pick up the graphs
+		const FLintCancellationToken* CancellationToken = FLintCancellationToken::GetCurrent();
+		ParallelFor(Graphs.Num(), [&Graphs, &Results, &CheckGraph, CancellationToken](int32 GraphIndex)
+		{
+			FLintCancellationToken::FScope CancellationScope(CancellationToken);
+			if (!IsLintRunCancelled())
+			{
+				Results[GraphIndex] = CheckGraph(Graphs[GraphIndex]);
+			}
+		}, Graphs.Num() < MinGraphsToCheckInParallel || RequiresGameThread());
+
+		return Results;
+	}
+
+	/** Below this many graphs, checking them one after another is cheaper than handing them out to other threads. */
+	static const int32 MinGraphsToCheckInParallel = 16;
 };
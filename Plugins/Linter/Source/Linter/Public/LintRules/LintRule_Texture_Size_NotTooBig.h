@@ -22,7 +22,13 @@ public:
 
 	virtual bool PassesRule(UObject* ObjectToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const override;
 
+	virtual bool LintsInBatches() const override { return true; }
+	virtual bool PassesRuleBatch(TArrayView<UObject* const> ObjectsToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const override;
+
 protected:
 	virtual bool PassesRule_Internal_Implementation(UObject* ObjectToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const override;
 
+	/** The size check shared by PassesRule_Internal and PassesRuleBatch. */
+	bool IsTooBig(int32 TexSizeX, int32 TexSizeY) const { return TexSizeX > MaxTextureSizeX || TexSizeY > MaxTextureSizeY; }
+
 };
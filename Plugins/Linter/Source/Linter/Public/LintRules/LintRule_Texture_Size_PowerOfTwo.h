@@ -7,6 +7,8 @@
 
 #include "LintRule_Texture_Size_PowerOfTwo.generated.h"
 
+class UTexture2D;
+
 UCLASS(BlueprintType, Blueprintable, Abstract)
 class LINTER_API ULintRule_Texture_Size_PowerOfTwo : public ULintRule
 {
@@ -20,7 +22,14 @@ public:
 
 	virtual bool PassesRule(UObject* ObjectToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const override;
 
+	virtual bool LintsInBatches() const override { return true; }
+	virtual bool PassesRuleBatch(TArrayView<UObject* const> ObjectsToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const override;
+
 protected:
 	virtual bool PassesRule_Internal_Implementation(UObject* ObjectToLint, const ULintRuleSet* ParentRuleSet, TArray<FLintRuleViolation>& OutRuleViolations) const override;
 
+	/** The LOD group and size checks shared by PassesRule, PassesRule_Internal and PassesRuleBatch. */
+	bool IsIgnored(const UTexture2D* Texture) const;
+	static bool IsPowerOfTwo(int32 TexSize) { return (TexSize & (TexSize - 1)) == 0; }
+
 };
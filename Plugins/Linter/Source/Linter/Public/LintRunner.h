@@ -3,19 +3,37 @@
 
 #include "CoreMinimal.h"
 #include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeBool.h"
 #include "HAL/Runnable.h"
 #include "AssetData.h"
 #include "Linter.h"
+#include "LintRuleSet.h"
 
 class FLintRunner : public FRunnable
 {
 
 public:
 
-	FLintRunner(UObject* InLoadedObject, const ULintRuleSet* LintRuleSet, TArray<FLintRuleViolation>* InpOutRuleViolations, FScopedSlowTask* InParentScopedSlowTask);
+	/** InRuleFilter picks which of the object's rules this runner runs, so game thread rules and the rest can run in separate runners. */
+	FLintRunner(UObject* InLoadedObject, const ULintRuleSet* LintRuleSet, TArray<FLintRuleViolation>* InpOutRuleViolations, FScopedSlowTask* InParentScopedSlowTask, const FLintCancellationToken* InRunCancellationToken = nullptr, ELintRuleThreadFilter InRuleFilter = ELintRuleThreadFilter::AllRules);
+
+	/** Runs the object's rule list of every one of LintRuleSets, one rule set after another, so several rule sets never need more than one runner per object. */
+	FLintRunner(UObject* InLoadedObject, const TArray<const ULintRuleSet*>& LintRuleSets, TArray<FLintRuleViolation>* InpOutRuleViolations, FScopedSlowTask* InParentScopedSlowTask, const FLintCancellationToken* InRunCancellationToken = nullptr, ELintRuleThreadFilter InRuleFilter = ELintRuleThreadFilter::AllRules);
 
 	virtual bool RequiresGamethread();
 
+	/** False if none of the object's rules pass this runner's rule filter, in which case running it does nothing. */
+	bool HasRulesToRun() const;
+
+	/** Leaves rules that lint in batches to the caller, which runs them once every asset has been loaded. */
+	void ExcludeBatchedRules() { bIncludeBatchedRules = false; }
+
+	/** How long the last Run spent running rules, in seconds. */
+	double GetRunSeconds() const { return RunSeconds; }
+
+	/** True once Run has returned, after which its violations have been added to the output array. */
+	bool IsFinished() const { return bFinished; }
+
 	virtual bool Init() override;
 	virtual uint32 Run() override;
 	virtual void Stop() override;
@@ -23,12 +41,20 @@ public:
 
 protected:
 	UObject* LoadedObject = nullptr;
-	const ULintRuleSet* RuleSet = nullptr;
 	TArray<FLintRuleViolation>* pOutRuleViolations;
 
-	const FLintRuleList* pLoadedRuleList;
+	/** Each rule set this runner lints with, along with its rule list for the object's class. Rule sets without one are left out. */
+	TArray<TPair<const ULintRuleSet*, const FLintRuleList*>> LoadedRuleLists;
+	ELintRuleThreadFilter RuleFilter;
+	bool bIncludeBatchedRules = true;
 	static FCriticalSection LintDataUpdateLock;
 
 	FScopedSlowTask* ParentScopedSlowTask;
+
+	/** Cancelled by Stop, or whenever the run this runner belongs to is cancelled. */
+	FLintCancellationToken CancellationToken;
+
+	double RunSeconds = 0.0;
+	FThreadSafeBool bFinished;
 };
 
@@ -8,6 +8,8 @@
 #include "Styling/SlateStyle.h"
 
 class FLinterManagerBase;
+class FLintOnSaveWatcher;
+class FLintIdleSweeper;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogLinter, Verbose, All);
 DECLARE_LOG_CATEGORY_EXTERN(LogCommandlet, All, All);
@@ -45,13 +47,28 @@ public:
 		}
 	}
 
+	/** Paths whose assets are linted before any other desired lint paths, i.e. folders picked in the Content Browser. */
+	virtual const TArray<FString>& GetPriorityLintPaths() const
+	{
+		return PriorityLintPaths;
+	}
+	virtual void SetPriorityLintPaths(TArray<FString> LintPaths)
+	{
+		PriorityLintPaths = LintPaths;
+	}
+
 private:
 	FDelegateHandle LevelEditorTabManagerChangedHandle;
 	FDelegateHandle ContentBrowserExtenderDelegateHandle;
 	FDelegateHandle AssetExtenderDelegateHandle;
+	FDelegateHandle AssetViewExtraStateDelegateHandle;
 
 	TArray<FString> DesiredLintPaths;
+	TArray<FString> PriorityLintPaths;
+
+	TSharedPtr<FLintOnSaveWatcher> LintOnSaveWatcher;
+	TSharedPtr<FLintIdleSweeper> LintIdleSweeper;
 public:
-	void OnInitialAssetRegistrySearchComplete();
+	/** Loads every rule set the asset registry knows about. Rule sets are otherwise only loaded when they are first used to lint. */
 	static void TryToLoadAllLintRuleSets();
 };
\ No newline at end of file
@@ -3,10 +3,10 @@
 #pragma once
 
 
-// Integrate Linter actions into the Content Browser
+// Integrate Linter actions and cached lint status into the Content Browser
 class FLinterContentBrowserExtensions
 {
 public:
-	static void InstallHooks(FLinterModule* LinterModule, class FDelegateHandle* pContentBrowserExtenderDelegateHandle, class FDelegateHandle* pAssetExtenderDelegateHandle);
-	static void RemoveHooks(FLinterModule* LinterModule, class FDelegateHandle* pContentBrowserExtenderDelegateHandle, class FDelegateHandle* pAssetExtenderDelegateHandle);
+	static void InstallHooks(FLinterModule* LinterModule, class FDelegateHandle* pContentBrowserExtenderDelegateHandle, class FDelegateHandle* pAssetExtenderDelegateHandle, class FDelegateHandle* pAssetViewExtraStateDelegateHandle);
+	static void RemoveHooks(FLinterModule* LinterModule, class FDelegateHandle* pContentBrowserExtenderDelegateHandle, class FDelegateHandle* pAssetExtenderDelegateHandle, class FDelegateHandle* pAssetViewExtraStateDelegateHandle);
 };
\ No newline at end of file
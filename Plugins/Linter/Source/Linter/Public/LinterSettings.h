@@ -20,4 +20,42 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = Settings)
 	TAssetPtr<ULintRuleSet> DefaultLintRuleSet;
 
+	/** Lint assets with the default rule set in the background whenever they are saved, imported or renamed. */
+	UPROPERTY(EditAnywhere, config, Category = "Lint On Save")
+	bool bLintOnSave = false;
+
+	/** Seconds to wait after the last save, import or rename before linting, so that bursts of changes are linted together. */
+	UPROPERTY(EditAnywhere, config, Category = "Lint On Save", meta = (EditCondition = "bLintOnSave", ClampMin = "0.0"))
+	float LintOnSaveDelay = 1.0f;
+
+	/** Lint /Game with the default rule set in the background while the editor is idle, so the lint report can show cached results instead of linting. */
+	UPROPERTY(EditAnywhere, config, Category = "Idle Sweep")
+	bool bIdleSweep = false;
+
+	/** Seconds without any input before the editor is considered idle. */
+	UPROPERTY(EditAnywhere, config, Category = "Idle Sweep", meta = (EditCondition = "bIdleSweep", ClampMin = "1.0"))
+	float IdleSweepDelay = 60.0f;
+
+	/** The share of the editor's main thread the sweep may use while idle, in percent. */
+	UPROPERTY(EditAnywhere, config, Category = "Idle Sweep", meta = (EditCondition = "bIdleSweep", ClampMin = "1", ClampMax = "100"))
+	int32 IdleSweepMaxCPUPercent = 25;
+
+	/** The sweep waits while the editor process uses more CPU than this, in percent of all cores. */
+	UPROPERTY(EditAnywhere, config, Category = "Idle Sweep", meta = (EditCondition = "bIdleSweep", ClampMin = "1", ClampMax = "100"))
+	int32 IdleSweepBusyCPUPercent = 50;
+
+	/**
+	 * How many milliseconds per frame the Lint Report and Lint On Save may spend running rules that have to run on the game thread,
+	 * such as rules implemented in Blueprint. Other rules run on worker threads in the meantime.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Performance", meta = (ClampMin = "1.0", UIMin = "1.0", UIMax = "33.0"))
+	float GameThreadLintBudgetMs = 8.0f;
+
+	/**
+	 * The Lint Wizard fixes up redirectors in batches whose referencing packages add up to at most this many megabytes on disk,
+	 * collecting garbage between batches. Lower it if fixing up redirectors runs out of memory.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Fix Up Redirectors", meta = (ClampMin = "1"))
+	int32 RedirectorFixupBatchSizeMB = 1024;
+
 };
@@ -2,11 +2,48 @@
 #pragma once
 
 #include "Widgets/SCompoundWidget.h"
-#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STreeView.h"
 
 #include "LintReportAssetError.h"
+#include "LintReportSearchIndex.h"
 #include "LintRule.h"
 
+class FAsyncLintJob;
+class FAssetThumbnailPool;
+class FLintReportThumbnailCache;
+struct FLintReportRuleItem;
+
+/** A violating asset in the report along with all of its violations. */
+struct FLintReportAssetItem
+{
+	FAssetData AssetData;
+	TArray<TSharedPtr<FLintRuleViolation>> RuleViolations;
+
+	/** The search index id of each violation in RuleViolations. */
+	TArray<int32> SearchIds;
+
+	/** The rule tree node of each violation in RuleViolations, so removing this asset only touches its own violations. */
+	TArray<TSharedPtr<FLintReportRuleItem>> ViolationItems;
+
+	/** Where this item sits in the report's AssetItems. */
+	int32 ItemIndex = INDEX_NONE;
+};
+
+/** A node in the report's rule tree. Rule nodes own every violation of their rule and have one child node per violation. */
+struct FLintReportRuleItem
+{
+	const ULintRule* Rule = nullptr;
+
+	/** Set on violation nodes only. ChildIndex is where this node sits in its rule node's Children and RuleViolations. */
+	TSharedPtr<FLintRuleViolation> RuleViolation;
+	int32 SearchId = INDEX_NONE;
+	int32 ChildIndex = INDEX_NONE;
+
+	/** Set on rule nodes only. */
+	TArray<TSharedPtr<FLintRuleViolation>> RuleViolations;
+	TArray<TSharedPtr<FLintReportRuleItem>> Children;
+};
 
 class SLintReport : public SCompoundWidget
 {
@@ -20,23 +57,110 @@ public:
 
 public:
 	
+	virtual ~SLintReport();
+
 	void Construct(const FArguments& Args);
 	void Rebuild(const ULintRuleSet* SelectedLintRuleSet);
+
+	/** Lints with every rule set in SelectedLintRuleSets at once, loading each asset only once. */
+	void Rebuild(const TArray<const ULintRuleSet*>& SelectedLintRuleSets);
+
+	/** Lints a single asset again with the last used rule sets and patches its entries in the report in place. */
+	void RelintAsset(const FAssetData& AssetData);
+
+	/**
+	 * Drops several assets from the report and lints them again in the background, streaming their new entries in like a full lint.
+	 * Assets that no longer exist simply drop out of the report.
+	 */
+	void RelintAssets(const TArray<FAssetData>& AssetList);
+
+	void CancelLint();
+	bool IsLinting() const { return LintJob.IsValid(); }
+
+	/** Renames every asset in the report to the name its naming violation suggests, after asking for confirmation, then rescans. */
+	void FixNamingViolations();
+
 	TSharedRef<SWidget> GetViewButtonContent();
 
-	const ULintRuleSet* LastUsedRuleSet = nullptr;
+	/** True if any of the last used rule sets wants the wizard to show marketplace publishing info. */
+	bool ShowsMarketplacePublishingInfo() const;
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+private:
+	/** Adds newly found violations to the asset and rule indices and the error and warning counts. */
+	void AddToIndex(const TArray<FLintRuleViolation>& NewRuleViolations);
+
+	/** Removes every violation of the asset at ObjectPath from the indices and counts. Only touches that asset's own violations, so rows may change order. */
+	void RemoveFromIndex(FName ObjectPath);
+
+	void FinishReport(bool bWasCancelled);
+
+	/** Rebuilds the JSON and HTML exports if the index changed since they were last built. */
+	void UpdateExports();
+
+	void OnPackageSaved(const FString& PackageFileName, UObject* Outer);
+
+	/** Rebuilds the filtered items shown by the list views from the search index. */
+	void ApplyFilter();
+	void OnSearchTextChanged(const FText& SearchText);
+
+	TSharedRef<ITableRow> OnGenerateAssetRow(TSharedPtr<FLintReportAssetItem> InItem, const TSharedRef<STableViewBase>& OwnerTable);
+	TSharedRef<ITableRow> OnGenerateRuleRow(TSharedPtr<FLintReportRuleItem> InItem, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnGetRuleChildren(TSharedPtr<FLintReportRuleItem> InItem, TArray<TSharedPtr<FLintReportRuleItem>>& OutChildren);
+
+	FText GetResultsSummary() const;
+
+public:
+
+	TArray<const ULintRuleSet*> LastUsedRuleSets;
+
+	/** The paths the report was last built from. Saved packages under them are re-linted, whether or not they're in the report yet. */
+	TArray<FString> LastLintPaths;
 
 	TSharedPtr<STextBlock> ResultsTextBlockPtr;
-	TArray<TSharedPtr<FLintRuleViolation>> RuleViolations;
+	TSet<TSharedPtr<FLintRuleViolation>> RuleViolations;
 	TSharedPtr<class SComboButton> ViewOptionsComboButton;
-	TSharedPtr<SScrollBox> AssetDetailsScrollBoxPtr;
-	TSharedPtr<SScrollBox> RuleDetailsScrollBoxPtr;
+	TSharedPtr<SListView<TSharedPtr<FLintReportAssetItem>>> AssetDetailsListViewPtr;
+	TSharedPtr<STreeView<TSharedPtr<FLintReportRuleItem>>> RuleDetailsTreeViewPtr;
+
+	/** The violation index the list views are generated from. Only visible rows ever get widgets. */
+	TArray<TSharedPtr<FLintReportAssetItem>> AssetItems;
+	TArray<TSharedPtr<FLintReportRuleItem>> RuleItems;
+	TMap<const ULintRule*, TSharedPtr<FLintReportRuleItem>> RuleItemsByRule;
+	TMap<FName, TSharedPtr<FLintReportAssetItem>> AssetItemsByPath;
+
+	/** The items that pass the current search, which are what the list views actually show. */
+	FLintReportSearchIndex SearchIndex;
+	FLintReportSearchIndex::FQuery SearchQuery;
+	TBitArray<> SearchMatches;
+	TArray<TSharedPtr<FLintReportAssetItem>> FilteredAssetItems;
+	TArray<TSharedPtr<FLintReportRuleItem>> FilteredRuleItems;
+	bool bFilterDirty = false;
+
+	/** Exports are only built when requested, since re-linting a single asset would otherwise rebuild them every time. */
 	FString JsonReport;
 	FString HTMLReport;
+	bool bExportsDirty = true;
+	bool bWasCancelled = false;
+
+	/** Packages that were saved since the last tick and should be re-linted once no full lint is running. */
+	TSet<FName> PendingRelintPackages;
+	FDelegateHandle PackageSavedDelegateHandle;
+
+	/** The lint currently streaming results into this report, if any. */
+	TSharedPtr<FAsyncLintJob> LintJob;
+	TSharedPtr<FAssetThumbnailPool> ThumbnailPool;
+	TSharedPtr<FAssetThumbnailPool> RuleThumbnailPool;
+	TSharedPtr<FLintReportThumbnailCache> ThumbnailCache;
+
+	/** How many thumbnails are kept around at once. Rows only ask for thumbnails once they scroll into view. */
+	static const int32 MaxThumbnails = 128;
 
 	bool bHasRanReport = false;
 	int32 NumErrors = 0;
 	int32 NumWarnings = 0;
 
-	
+	/** How many violations in the report carry a suggested name that FixNamingViolations could apply. */
+	int32 NumSuggestedRenames = 0;
 };
\ No newline at end of file
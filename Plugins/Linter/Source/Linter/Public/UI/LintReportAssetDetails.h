@@ -3,6 +3,9 @@
 #include "Widgets/SCompoundWidget.h"
 #include "LintRule.h"
 
+class FLintReportThumbnailCache;
+struct FSlateDynamicImageBrush;
+
 class SLintReportAssetDetails : public SCompoundWidget
 {
 public:
@@ -13,6 +16,10 @@ public:
 	SLATE_ATTRIBUTE(FAssetData, AssetData)
 	SLATE_ATTRIBUTE(TArray<TSharedPtr<FLintRuleViolation>>, RuleViolations)
 	SLATE_ATTRIBUTE(TSharedPtr<FAssetThumbnailPool>, ThumbnailPool)
+	SLATE_ARGUMENT(TSharedPtr<FLintReportThumbnailCache>, ThumbnailCache)
+
+	/** Called when the user asks for this asset to be linted again. The re-lint button is hidden if unbound. */
+	SLATE_EVENT(FSimpleDelegate, OnRelint)
 	
 	SLATE_END_ARGS()
 
@@ -24,4 +31,8 @@ public:
 public:
 	
 	void Construct(const FArguments& Args);
+
+private:
+	/** The package's saved thumbnail, kept alive for as long as this row is visible. */
+	TSharedPtr<FSlateDynamicImageBrush> CachedThumbnailBrush;
 };
\ No newline at end of file
@@ -0,0 +1,77 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"
+#include "LintRule.h"
+
+/**
+ * Indexes the violations shown in the lint report so that filters can be applied without walking every violation's text.
+ * Each violation gets a stable id. Paths go into a trie of folders and messages are tokenized into postings lists,
+ * so a query only touches the postings of the terms it names and produces a bit per id.
+ */
+class FLintReportSearchIndex
+{
+public:
+	struct FQuery
+	{
+		/** Matches violations at least this severe. */
+		TOptional<ELintRuleSeverity> MaxSeverity;
+		FName RuleGroup;
+		FName AssetClass;
+		FString PathPrefix;
+		TArray<FString> TextTokens;
+
+		bool IsEmpty() const
+		{
+			return !MaxSeverity.IsSet() && RuleGroup.IsNone() && AssetClass.IsNone() && PathPrefix.IsEmpty() && TextTokens.Num() == 0;
+		}
+
+		/**
+		 * Parses search box text. Free text is matched against token prefixes of the rule title, the recommended action and the asset name.
+		 * "severity:", "group:", "class:" and "path:" filter on the respective field, i.e. "severity:warning path:/Game/Characters texture".
+		 */
+		static FQuery Parse(const FString& SearchText);
+	};
+
+	/** Adds a violation and returns its id. Ids are never reused. */
+	int32 Add(const TSharedPtr<FLintRuleViolation>& Violation);
+	void Remove(int32 Id);
+	void Reset();
+
+	/** Returns one bit per id, set for every live violation matching the query. */
+	TBitArray<> Search(const FQuery& Query) const;
+
+private:
+	struct FPathNode
+	{
+		TMap<FName, int32> Children;
+		TArray<int32> Postings;
+	};
+
+	/** Orders tokens by their characters, so every token sharing a prefix sits in one contiguous range right after where the prefix would go. */
+	static bool TokenLess(const FString& A, const FString& B) { return A.Compare(B, ESearchCase::CaseSensitive) < 0; }
+
+	static void Tokenize(const FString& Text, TArray<FString>& OutTokens);
+	static void SetBits(TBitArray<>& Bits, const TArray<int32>& Postings);
+	static void AndBits(TBitArray<>& Bits, const TBitArray<>& Other);
+	void SetPathBits(TBitArray<>& Bits, int32 NodeIndex) const;
+
+	/** Sorts SortedTokens again if tokens were added since the last search. */
+	void SortTokens() const;
+
+	TArray<TSharedPtr<FLintRuleViolation>> Entries;
+	TBitArray<> LiveEntries;
+
+	TArray<int32> SeverityPostings[3];
+	TMap<FName, TArray<int32>> RuleGroupPostings;
+	TMap<FName, TArray<int32>> AssetClassPostings;
+	TMap<FString, TArray<int32>> TokenPostings;
+
+	/** Every key of TokenPostings, sorted so a prefix is found with a binary search instead of comparing against every token. Only sorted when searched. */
+	mutable TArray<FString> SortedTokens;
+	mutable bool bSortedTokensDirty = false;
+
+	/** Node 0 is the root. Every node holds the ids of the violations directly in that folder. */
+	TArray<FPathNode> PathNodes;
+};
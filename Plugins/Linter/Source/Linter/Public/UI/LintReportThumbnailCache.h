@@ -0,0 +1,28 @@
+// Copyright 2019-2020 Gamemakin LLC. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetData.h"
+#include "Containers/LruCache.h"
+
+struct FSlateDynamicImageBrush;
+
+/**
+ * A fixed size, least recently used cache of the thumbnails that were saved into asset packages.
+ * Thumbnails are read from disk when a report row first asks for them and are never rendered.
+ */
+class FLintReportThumbnailCache
+{
+public:
+	explicit FLintReportThumbnailCache(int32 InMaxNumThumbnails);
+
+	/** Returns the package's cached thumbnail for this asset, or null if the package has none. */
+	TSharedPtr<FSlateDynamicImageBrush> FindOrLoad(const FAssetData& AssetData);
+
+private:
+	/** Assets without a cached thumbnail are stored as null so their packages aren't read again. */
+	TLruCache<FName, TSharedPtr<FSlateDynamicImageBrush>> Thumbnails;
+
+	/** Evicted brushes may still be on screen, so every brush gets its own resource name. */
+	int32 NextResourceId = 0;
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/Workflow/SWizard.h"
+#include "Widgets/Layout/SScrollBox.h"
 #include "UI/SStepWidget.h"
 
 #include "LintReport.h"
@@ -28,8 +29,8 @@ public:
 	/** The Lint Report widget */
 	TSharedPtr<SLintReport> LintReport;
 
-	/** The Linter combo box selection to use to select a linter rule set. */
-	TSharedPtr<SComboBox<TSharedPtr<FAssetData>>> RuleSetSelectionComboBox;
+	/** The list of rule sets to lint with, one check box each. */
+	TSharedPtr<SListView<TSharedPtr<FAssetData>>> RuleSetSelectionListView;
 
 	/** List of Linter managers grabbed from the Linter Module on widget creation */
 	TArray<TSharedPtr<FAssetData>> RuleSets;
@@ -40,8 +41,8 @@ public:
 	/** Scrollbox for list of map assets in marketplace recommendation page */
 	TSharedPtr<SScrollBox> MarketplaceRecommendationMapScrollBoxPtr;
 
-	/** Currently selected Linter Rule Set */
-	TSharedPtr<FAssetData> SelectedRuleSet;
+	/** Currently checked Linter Rule Sets. Every one of them is run in the same pass, so each asset is only loaded once. */
+	TArray<TSharedPtr<FAssetData>> SelectedRuleSets;
 
 	bool bOfferPackage = false;
 	EStepStatus FixUpRedirectorStatus = EStepStatus::Unknown;
@@ -50,5 +51,8 @@ public:
 	void OnLintReportEntered();
 	void OnMarketplaceRecommendationsEntered();
 
+	/** The rule set's description from its asset registry tags, or its path if it has none, without loading it. */
+	static FText GetRuleSetDescription(const FAssetData& RuleSetData);
+
 	bool LoadAssetsIfNeeded(const TArray<FString>& ObjectPaths, TArray<UObject*>& LoadedObjects);
 };
@@ -30,6 +30,7 @@ public:
 	SLATE_BEGIN_ARGS(SStepWidget)
 		: _StepStatus(EStepStatus::NoStatus)
 		, _ShowStepStatusIcon(true)
+		, _CanCancel(false)
 	{
 	}
 
@@ -51,6 +52,9 @@ public:
 		/** Current status for this step. */
 		SLATE_ATTRIBUTE(bool, ShowStepStatusIcon)
 
+		/** Whether the progress dialog shown while performing this step's action has a cancel button. The action must check ShouldCancel() itself. */
+		SLATE_ARGUMENT(bool, CanCancel)
+
 		/** Delegate to fire when this step's action is invoked. */
 		SLATE_EVENT(FOnStepPerformAction, OnPerformAction)
 
@@ -61,6 +65,7 @@ public:
 	TAttribute<FText> StepActionText;
 	FOnStepPerformAction OnPerformAction;
 	TAttribute<bool> ShowStepStatusIcon;
+	bool bCanCancel = false;
 
 	bool IsStepCompleted(bool bAllowWarning = true);
 	